@@ -24,6 +24,8 @@
  * animation.c — Sprite compositing and drawing for MicroPython on ESP32-S3.
  *
  * Pipeline: fill_background → draw_all → tft.blit_buffer
+ *       or: render(tft, background), band by band into the DMA buffers
+ *       or: execute(cmdlist, display_buf), replaying a recorded CommandList
  *
  * All drawing targets a Python bytearray (display_buf) that you manage.
  * Hardware init/blit lives in esp_lcd.c (ESPLCD).
@@ -31,6 +33,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include "esp_heap_caps.h"
 #include "py/obj.h"
 #include "py/objstr.h"
 #include "py/objmodule.h"
@@ -43,16 +46,72 @@
 
 // ─── Constants ────────────────────────────────────────────────────────────────
 
-#define MAX_SLOTS    16
+#define MAX_SLOTS    16      // slots available before set_slot_count()
+#define MAX_SLOT_POOL 4096   // upper limit for set_slot_count()
+#define BUCKET_ROWS  16      // draw_all's band height for slot bucketing
 #define MAGIC_COLOR  58572   // RGB565 transparency key: RGB(231,154,99)
 
+// Build with -DANIMATION_BENCH=1 to add animation.bench_draw_all() and
+// animation.bench_blend(), which time the compositor and the opacity blend
+// against their original per-pixel versions.
+#ifndef ANIMATION_BENCH
+#define ANIMATION_BENCH 0
+#endif
+
 // ═══════════════════════════════════════════════════════════════════════════════
 // ─── Slot system ──────────────────────────────────────────────────────────────
 // ═══════════════════════════════════════════════════════════════════════════════
 
+// A sprite precompiled by compile_sprite(): for each row, the runs of pixels
+// that are not MAGIC_COLOR, as (x, len) pairs into the original pixel buffer.
+typedef struct {
+    mp_obj_base_t base;
+    mp_obj_t      src;         // keeps the pixel buffer alive
+    uint8_t      *pixels;
+    int16_t       w, h;
+    uint32_t     *row_run;     // h + 1 entries; row r owns runs [row_run[r], row_run[r + 1])
+    uint16_t     *runs;        // (x, len) pairs
+    size_t        n_runs;
+} anim_sprite_obj_t;
+
+static const mp_obj_type_t anim_sprite_type;
+
+// A frame sequence for set_slot_anim(): frames are buffers / compiled
+// sprites, or ints naming cells of the slot's atlas.
+enum { SEQ_LOOP, SEQ_PINGPONG, SEQ_ONCE };
+
+typedef struct {
+    mp_obj_base_t base;
+    size_t        n;
+    mp_obj_t     *frames;
+    mp_obj_t     *alphas;      // A8 plane per buffer frame, NULL = colour key
+    uint16_t     *durations;   // ms per frame
+    uint64_t      cycle_ms;    // one pass back to the same frame and direction
+    uint32_t      sprite_px;   // w×h of the CompiledSprite frames, 0 = none
+    bool          atlas;       // frames are atlas cell indices
+    uint8_t       mode;
+} anim_seq_obj_t;
+
+static const mp_obj_type_t anim_seq_type;
+
 typedef struct {
     uint8_t  *buf;
+    const anim_sprite_obj_t *sprite;   // opaque runs of buf, NULL = key every pixel
+    const uint8_t *alpha;      // w×h A8 plane from set_slot_alpha, NULL = colour key
     int16_t   x, y, w, h;
+    int16_t   stride;          // source pixels per row: w, or the atlas sheet width
+    uint8_t  *sheet;           // whole source buffer; buf = sheet + src_off pixels
+    const uint8_t *alpha_sheet;
+    uint32_t  sheet_px;        // pixels available in sheet / alpha_sheet
+    uint32_t  alpha_px;
+    uint32_t  src_off;         // current frame's first pixel in the sheet
+    int16_t   grid_x, grid_y;  // atlas origin for update_slot_frame
+    const anim_seq_obj_t *seq; // frame sequence advanced by tick(), NULL = static
+    uint16_t  seq_frame;
+    int8_t    seq_dir;         // +1 / -1 while ping-ponging
+    bool      seq_done;        // a "once" sequence reached its last frame
+    uint32_t  seq_elapsed;     // ms spent on seq_frame
+    int16_t   z;               // draw order: ascending z, then ascending index
     bool      enabled;
     uint8_t   opacity;         // 0 = invisible, 255 = fully opaque (default)
 
@@ -79,52 +138,314 @@ typedef struct {
                                // false = hide x out [x0, x1]  ("outside")
 } sprite_slot_t;
 
-static sprite_slot_t slots[MAX_SLOTS];
+// The pool starts as this static array and moves to the heap when
+// set_slot_count() grows it past MAX_SLOTS.
+static sprite_slot_t  slots_static[MAX_SLOTS];
+static sprite_slot_t *slots   = slots_static;
+static int            n_slots = MAX_SLOTS;
 static int16_t display_w = 240;
 static int16_t display_h = 240;
 
+// ─── Draw order and band buckets ─────────────────────────────────────────────
+// Slots are drawn in ascending z, ties in index order. The sorted order is
+// cached and only re-sorted after a z or pool size change. The drawable slots
+// are also bucketed by screen band of bucket_rows rows, and the buckets are
+// rebuilt only after a slot moves, changes buffer or is toggled, so a band
+// renderer visits just the slots that touch its band.
+
+static uint16_t *draw_order;        // n_slots slot indices sorted by (z, index)
+static int       draw_order_len;
+static uint16_t *draw_list;         // enabled, on-screen slots in draw order
+static int       draw_count;
+static uint32_t *bucket_start;      // n_buckets + 1 offsets into bucket_items
+static uint16_t *bucket_items;      // slot indices per band, in draw order
+static size_t    bucket_cap;
+static int       bucket_rows;
+static int       n_buckets;
+static bool      order_dirty  = true;
+static bool      layout_dirty = true;
+
+// The slot pool, draw order and buckets are read by every composite, so they
+// prefer internal RAM and only move to SPIRAM once internal RAM is full.
+static void *pool_realloc(void *p, size_t size) {
+    if (size == 0) size = 1;
+    void *q = heap_caps_realloc(p, size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (q == NULL)
+        q = heap_caps_realloc(p, size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (q == NULL)
+        mp_raise_msg(&mp_type_MemoryError, MP_ERROR_TEXT("out of memory for slot pool"));
+    return q;
+}
+
+static inline bool slot_before(int a, int b) {
+    return slots[a].z < slots[b].z || (slots[a].z == slots[b].z && a < b);
+}
+
+static void order_update(void) {
+    if (!order_dirty) return;
+    if (draw_order_len != n_slots) {
+        draw_order = pool_realloc(draw_order, n_slots * sizeof(uint16_t));
+        for (int i = 0; i < n_slots; i++) draw_order[i] = i;
+        draw_order_len = n_slots;
+    }
+    // Insertion sort from the previous order: linear when few z values moved
+    for (int i = 1; i < n_slots; i++) {
+        uint16_t k = draw_order[i];
+        int      j = i - 1;
+        while (j >= 0 && slot_before(k, draw_order[j])) {
+            draw_order[j + 1] = draw_order[j];
+            j--;
+        }
+        draw_order[j + 1] = k;
+    }
+    order_dirty  = false;
+    layout_dirty = true;
+}
+
+// Screen rows [*y0, *y1) covered by a drawable slot; false if it is off
+// screen, disabled or has no buffer.
+static bool slot_rows(const sprite_slot_t *slot, int *y0, int *y1) {
+    if (!slot->enabled || slot->buf == NULL || slot->w <= 0 || slot->h <= 0) return false;
+    if (slot->x >= display_w || slot->x + slot->w <= 0) return false;
+    *y0 = slot->y > 0 ? slot->y : 0;
+    *y1 = slot->y + slot->h < display_h ? slot->y + slot->h : display_h;
+    return *y0 < *y1;
+}
+
+static void layout_update(int rows) {
+    if (rows < 1) rows = 1;
+    if (!layout_dirty && !order_dirty && rows == bucket_rows) return;
+    order_update();
+
+    int nb = (display_h + rows - 1) / rows;
+    draw_list    = pool_realloc(draw_list, n_slots * sizeof(uint16_t));
+    bucket_start = pool_realloc(bucket_start, (nb + 1) * sizeof(uint32_t));
+    memset(bucket_start, 0, (nb + 1) * sizeof(uint32_t));
+
+    // Count the bands each drawable slot touches
+    draw_count = 0;
+    size_t total = 0;
+    for (int k = 0; k < n_slots; k++) {
+        int i = draw_order[k], y0, y1;
+        if (!slot_rows(&slots[i], &y0, &y1)) continue;
+        draw_list[draw_count++] = i;
+        for (int b = y0 / rows; b <= (y1 - 1) / rows; b++) {
+            bucket_start[b + 1]++;
+            total++;
+        }
+    }
+    if (total > bucket_cap) {
+        bucket_items = pool_realloc(bucket_items, total * sizeof(uint16_t));
+        bucket_cap   = total;
+    }
+    for (int b = 0; b < nb; b++) bucket_start[b + 1] += bucket_start[b];
+
+    // Fill in draw order; bucket_start[b] advances to the start of b + 1
+    for (int k = 0; k < draw_count; k++) {
+        int i = draw_list[k], y0, y1;
+        slot_rows(&slots[i], &y0, &y1);
+        for (int b = y0 / rows; b <= (y1 - 1) / rows; b++)
+            bucket_items[bucket_start[b]++] = i;
+    }
+    for (int b = nb; b > 0; b--) bucket_start[b] = bucket_start[b - 1];
+    bucket_start[0] = 0;
+
+    n_buckets    = nb;
+    bucket_rows  = rows;
+    layout_dirty = false;
+}
+
 // ─── set_display_size ────────────────────────────────────────────────────────
 
 static mp_obj_t animation_set_display_size(mp_obj_t w_in, mp_obj_t h_in) {
     display_w = (int16_t)mp_obj_get_int(w_in);
     display_h = (int16_t)mp_obj_get_int(h_in);
+    layout_dirty = true;
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_2(animation_set_display_size_obj, animation_set_display_size);
 
+// ─── Slot references ─────────────────────────────────────────────────────────
+// The slot pool lives outside the GC heap, so the objects a slot points into
+// are also kept in this list, SLOT_REFS entries per slot, to stay reachable:
+// its buffer or CompiledSprite / atlas sheet, its alpha plane and its Sequence.
+
+enum { SLOT_REF_SRC, SLOT_REF_ALPHA, SLOT_REF_SEQ, SLOT_REFS };
+
+MP_REGISTER_ROOT_POINTER(mp_obj_t animation_slot_refs);
+
+static void slot_ref_set(int idx, int kind, mp_obj_t obj) {
+    if (MP_STATE_VM(animation_slot_refs) == MP_OBJ_NULL) {
+        if (obj == mp_const_none) return;
+        MP_STATE_VM(animation_slot_refs) = mp_obj_new_list(0, NULL);
+    }
+    mp_obj_t  refs = MP_STATE_VM(animation_slot_refs);
+    size_t    pos  = (size_t)idx * SLOT_REFS + kind;
+    size_t    len;
+    mp_obj_t *items;
+    mp_obj_list_get(refs, &len, &items);
+    if (pos >= len) {
+        if (obj == mp_const_none) return;
+        for (; len < (size_t)(idx + 1) * SLOT_REFS; len++)
+            mp_obj_list_append(refs, mp_const_none);
+        mp_obj_list_get(refs, &len, &items);
+    }
+    items[pos] = obj;
+}
+
+static void slot_refs_clear(int idx) {
+    for (int kind = 0; kind < SLOT_REFS; kind++)
+        slot_ref_set(idx, kind, mp_const_none);
+}
+
 // ─── clear_slots ─────────────────────────────────────────────────────────────
 
+static void slot_reset(sprite_slot_t *slot) {
+    slot_refs_clear(slot - slots);
+    slot->enabled        = false;
+    slot->buf            = NULL;
+    slot->sprite         = NULL;
+    slot->alpha          = NULL;
+    slot->alpha_sheet    = NULL;
+    slot->seq            = NULL;
+    slot->z              = 0;
+    slot->opacity        = 255;
+    slot->clip_y_enabled = false;
+    slot->clip_x_enabled = false;
+    slot->crop_y_enabled = false;
+    slot->crop_x_enabled = false;
+}
+
 static mp_obj_t animation_clear_slots(void) {
-    for (int i = 0; i < MAX_SLOTS; i++) {
-        slots[i].enabled        = false;
-        slots[i].buf            = NULL;
-        slots[i].opacity        = 255;
-        slots[i].clip_y_enabled = false;
-        slots[i].clip_x_enabled = false;
-        slots[i].crop_y_enabled = false;
-        slots[i].crop_x_enabled = false;
-    }
+    for (int i = 0; i < n_slots; i++)
+        slot_reset(&slots[i]);
+    MP_STATE_VM(animation_slot_refs) = MP_OBJ_NULL;
+    order_dirty  = true;
+    layout_dirty = true;
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_0(animation_clear_slots_obj, animation_clear_slots);
 
+// ─── set_slot_count ──────────────────────────────────────────────────────────
+// set_slot_count(n)
+// Resizes the slot pool to n slots (1–MAX_SLOT_POOL). Existing slots below n
+// are kept; new slots start cleared and disabled.
+
+static mp_obj_t animation_set_slot_count(mp_obj_t n_in) {
+    int n = mp_obj_get_int(n_in);
+    if (n < 1 || n > MAX_SLOT_POOL)
+        mp_raise_ValueError(MP_ERROR_TEXT("slot count out of range"));
+    if (n == n_slots) return mp_const_none;
+
+    int keep = n < n_slots ? n : n_slots;
+    for (int i = keep; i < n_slots; i++)
+        slot_refs_clear(i);
+    if (n <= MAX_SLOTS) {
+        if (slots != slots_static) {
+            memcpy(slots_static, slots, keep * sizeof(sprite_slot_t));
+            heap_caps_free(slots);
+            slots = slots_static;
+        }
+    } else if (slots == slots_static) {
+        sprite_slot_t *pool = pool_realloc(NULL, n * sizeof(sprite_slot_t));
+        memcpy(pool, slots_static, keep * sizeof(sprite_slot_t));
+        slots = pool;
+    } else {
+        slots = pool_realloc(slots, n * sizeof(sprite_slot_t));
+    }
+    for (int i = keep; i < n; i++)
+        slot_reset(&slots[i]);
+    n_slots      = n;
+    order_dirty  = true;
+    layout_dirty = true;
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(animation_set_slot_count_obj, animation_set_slot_count);
+
+// Pixels of the sheet a w×h frame at src_off reaches
+static inline uint32_t slot_src_extent(const sprite_slot_t *slot, uint32_t src_off) {
+    return src_off + (uint32_t)(slot->h - 1) * slot->stride + slot->w;
+}
+
+// Point a slot's current frame at src_off pixels into its sheet
+static void slot_set_src(sprite_slot_t *slot, uint32_t src_off) {
+    slot->src_off = src_off;
+    slot->buf     = slot->sheet + src_off * 2;
+    if (slot->alpha_sheet) slot->alpha = slot->alpha_sheet + src_off;
+}
+
+// Point a slot at a raw RGB565 buffer drawn at w×h, or at a compiled sprite,
+// which brings its own size. Either one replaces an atlas: the source is
+// contiguous again. A raw buffer smaller than w×h raises before the slot is
+// touched; an alpha plane too small for the new frame is dropped rather than
+// read past its end.
+static void slot_set_buf(sprite_slot_t *slot, mp_obj_t buf_in, int w, int h) {
+    if (mp_obj_is_type(buf_in, &anim_sprite_type)) {
+        const anim_sprite_obj_t *sprite = MP_OBJ_TO_PTR(buf_in);
+        slot->sheet    = sprite->pixels;
+        slot->sheet_px = (uint32_t)sprite->w * sprite->h;
+        slot->sprite   = sprite;
+        slot->w        = sprite->w;
+        slot->h        = sprite->h;
+    } else {
+        mp_buffer_info_t info;
+        mp_get_buffer_raise(buf_in, &info, MP_BUFFER_READ);
+        if (w > 0 && h > 0 && info.len / 2 < (size_t)w * h)
+            mp_raise_ValueError(MP_ERROR_TEXT("buffer too small for the slot"));
+        slot->sheet    = (uint8_t *)info.buf;
+        slot->sheet_px = info.len / 2;
+        slot->sprite   = NULL;
+        slot->w        = w;
+        slot->h        = h;
+    }
+    slot->stride = slot->w;
+    slot->grid_x = 0;
+    slot->grid_y = 0;
+    slot_ref_set(slot - slots, SLOT_REF_SRC, buf_in);
+    if (slot->alpha_sheet && slot_src_extent(slot, 0) > slot->alpha_px) {
+        slot->alpha       = NULL;
+        slot->alpha_sheet = NULL;
+        slot_ref_set(slot - slots, SLOT_REF_ALPHA, mp_const_none);
+    }
+    slot_set_src(slot, 0);
+}
+
+// Select cell `frame` of an atlas slot: cells of w×h, left to right then top
+// to bottom, starting at the atlas origin. Returns false if it is off the sheet.
+static bool slot_set_frame(sprite_slot_t *slot, int frame) {
+    int cols = (slot->stride - slot->grid_x) / slot->w;
+    if (frame < 0 || cols <= 0) return false;
+    uint32_t src_off = (uint32_t)(slot->grid_y + (frame / cols) * slot->h) * slot->stride
+                     + slot->grid_x + (frame % cols) * slot->w;
+    uint32_t extent  = slot_src_extent(slot, src_off);
+    if (extent > slot->sheet_px || (slot->alpha_sheet && extent > slot->alpha_px)) return false;
+    slot_set_src(slot, src_off);
+    return true;
+}
+
 // ─── set_slot ────────────────────────────────────────────────────────────────
 
 static mp_obj_t animation_set_slot(size_t n_args, const mp_obj_t *args) {
     int idx = mp_obj_get_int(args[0]);
-    if (idx < 0 || idx >= MAX_SLOTS)
+    if (idx < 0 || idx >= n_slots)
         mp_raise_ValueError(MP_ERROR_TEXT("slot index out of range"));
-    mp_buffer_info_t info;
-    mp_get_buffer_raise(args[1], &info, MP_BUFFER_READ);
-    slots[idx].buf            = (uint8_t *)info.buf;
-    slots[idx].x              = (int16_t)mp_obj_get_int(args[2]);
-    slots[idx].y              = (int16_t)mp_obj_get_int(args[3]);
-    slots[idx].w              = (int16_t)mp_obj_get_int(args[4]);
-    slots[idx].h              = (int16_t)mp_obj_get_int(args[5]);
+    int16_t x = (int16_t)mp_obj_get_int(args[2]);
+    int16_t y = (int16_t)mp_obj_get_int(args[3]);
+    int16_t w = (int16_t)mp_obj_get_int(args[4]);
+    int16_t h = (int16_t)mp_obj_get_int(args[5]);
+    slot_set_buf(&slots[idx], args[1], w, h);
+    slots[idx].x              = x;
+    slots[idx].y              = y;
+    slots[idx].alpha          = NULL;
+    slots[idx].alpha_sheet    = NULL;
+    slot_ref_set(idx, SLOT_REF_ALPHA, mp_const_none);
+    slots[idx].seq            = NULL;
+    slot_ref_set(idx, SLOT_REF_SEQ, mp_const_none);
     slots[idx].enabled        = true;
     slots[idx].opacity        = 255;
     slots[idx].clip_y_enabled = false;
     slots[idx].clip_x_enabled = false;
+    layout_dirty              = true;
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(animation_set_slot_obj, 6, 6, animation_set_slot);
@@ -133,13 +454,12 @@ static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(animation_set_slot_obj, 6, 6, animati
 
 static mp_obj_t animation_update_slot(size_t n_args, const mp_obj_t *args) {
     int idx = mp_obj_get_int(args[0]);
-    if (idx < 0 || idx >= MAX_SLOTS)
+    if (idx < 0 || idx >= n_slots)
         mp_raise_ValueError(MP_ERROR_TEXT("slot index out of range"));
-    mp_buffer_info_t info;
-    mp_get_buffer_raise(args[1], &info, MP_BUFFER_READ);
-    slots[idx].buf = (uint8_t *)info.buf;
+    slot_set_buf(&slots[idx], args[1], slots[idx].w, slots[idx].h);
     slots[idx].x   = (int16_t)mp_obj_get_int(args[2]);
     slots[idx].y   = (int16_t)mp_obj_get_int(args[3]);
+    layout_dirty   = true;
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(animation_update_slot_obj, 4, 4, animation_update_slot);
@@ -148,10 +468,11 @@ static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(animation_update_slot_obj, 4, 4, anim
 
 static mp_obj_t animation_update_slot_pos(size_t n_args, const mp_obj_t *args) {
     int idx = mp_obj_get_int(args[0]);
-    if (idx < 0 || idx >= MAX_SLOTS)
+    if (idx < 0 || idx >= n_slots)
         mp_raise_ValueError(MP_ERROR_TEXT("slot index out of range"));
     slots[idx].x = (int16_t)mp_obj_get_int(args[1]);
     slots[idx].y = (int16_t)mp_obj_get_int(args[2]);
+    layout_dirty = true;
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(animation_update_slot_pos_obj, 3, 3, animation_update_slot_pos);
@@ -160,32 +481,415 @@ static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(animation_update_slot_pos_obj, 3, 3,
 
 static mp_obj_t animation_update_slot_buf(size_t n_args, const mp_obj_t *args) {
     int idx = mp_obj_get_int(args[0]);
-    if (idx < 0 || idx >= MAX_SLOTS)
+    if (idx < 0 || idx >= n_slots)
+        mp_raise_ValueError(MP_ERROR_TEXT("slot index out of range"));
+    slot_set_buf(&slots[idx], args[1], slots[idx].w, slots[idx].h);
+    layout_dirty = true;
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(animation_update_slot_buf_obj, 2, 2, animation_update_slot_buf);
+
+// ─── set_slot_atlas ──────────────────────────────────────────────────────────
+// set_slot_atlas(index, sheet, stride, src_x, src_y, w, h)
+// Shows the w×h cell at (src_x, src_y) of an RGB565 sheet `stride` pixels
+// wide, without copying. (src_x, src_y) is also the origin of the cell grid
+// used by update_slot_frame. Enables the slot like set_slot; position is kept.
+
+static mp_obj_t animation_set_slot_atlas(size_t n_args, const mp_obj_t *args) {
+    int idx = mp_obj_get_int(args[0]);
+    if (idx < 0 || idx >= n_slots)
         mp_raise_ValueError(MP_ERROR_TEXT("slot index out of range"));
     mp_buffer_info_t info;
     mp_get_buffer_raise(args[1], &info, MP_BUFFER_READ);
-    slots[idx].buf = (uint8_t *)info.buf;
+    int stride = mp_obj_get_int(args[2]);
+    int src_x  = mp_obj_get_int(args[3]);
+    int src_y  = mp_obj_get_int(args[4]);
+    int w      = mp_obj_get_int(args[5]);
+    int h      = mp_obj_get_int(args[6]);
+    if (w <= 0 || h <= 0 || stride > INT16_MAX || src_x < 0 || src_y < 0 || src_x + w > stride)
+        mp_raise_ValueError(MP_ERROR_TEXT("invalid atlas cell"));
+    if ((uint32_t)(src_y + h - 1) * stride + src_x + w > info.len / 2)
+        mp_raise_ValueError(MP_ERROR_TEXT("atlas cell outside the sheet"));
+
+    sprite_slot_t *slot = &slots[idx];
+    slot->sprite         = NULL;
+    slot->alpha          = NULL;
+    slot->alpha_sheet    = NULL;
+    slot->seq            = NULL;
+    slot_refs_clear(idx);
+    slot_ref_set(idx, SLOT_REF_SRC, args[1]);
+    slot->sheet          = (uint8_t *)info.buf;
+    slot->sheet_px       = info.len / 2;
+    slot->stride         = stride;
+    slot->grid_x         = src_x;
+    slot->grid_y         = src_y;
+    slot->w              = w;
+    slot->h              = h;
+    slot_set_src(slot, (uint32_t)src_y * stride + src_x);
+    slot->enabled        = true;
+    slot->opacity        = 255;
+    slot->clip_y_enabled = false;
+    slot->clip_x_enabled = false;
+    layout_dirty         = true;
     return mp_const_none;
 }
-static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(animation_update_slot_buf_obj, 2, 2, animation_update_slot_buf);
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(animation_set_slot_atlas_obj, 7, 7, animation_set_slot_atlas);
+
+// ─── update_slot_frame ───────────────────────────────────────────────────────
+// update_slot_frame(index, frame)
+// Selects cell `frame` of the slot's atlas grid: a pointer offset, no copy.
+
+static mp_obj_t animation_update_slot_frame(mp_obj_t idx_in, mp_obj_t frame_in) {
+    int idx = mp_obj_get_int(idx_in);
+    if (idx < 0 || idx >= n_slots)
+        mp_raise_ValueError(MP_ERROR_TEXT("slot index out of range"));
+    if (slots[idx].sheet == NULL || slots[idx].sprite)
+        mp_raise_ValueError(MP_ERROR_TEXT("slot has no atlas"));
+    if (!slot_set_frame(&slots[idx], mp_obj_get_int(frame_in)))
+        mp_raise_ValueError(MP_ERROR_TEXT("frame outside the atlas"));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(animation_update_slot_frame_obj, animation_update_slot_frame);
+
+// ─── Frame sequences ─────────────────────────────────────────────────────────
+// Sequence(frames, durations {, mode="loop", *, alphas=None})
+// frames   : list of buffers / CompiledSprites, or of atlas cell indices
+// durations: ms for every frame, or one value per frame (1–65535)
+// mode     : "loop", "pingpong" or "once"
+// alphas   : one A8 plane per buffer frame; atlas frames use the sheet's plane
+// Slots share a Sequence read-only; each slot keeps its own position in it.
+
+static mp_obj_t anim_seq_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_frames, ARG_durations, ARG_mode, ARG_alphas };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_frames,    MP_ARG_OBJ | MP_ARG_REQUIRED                             },
+        { MP_QSTR_durations, MP_ARG_OBJ | MP_ARG_REQUIRED                             },
+        { MP_QSTR_mode,      MP_ARG_OBJ,                   {.u_obj = mp_const_none } },
+        { MP_QSTR_alphas,    MP_ARG_OBJ | MP_ARG_KW_ONLY,  {.u_obj = mp_const_none } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args,
+        MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    size_t    n;
+    mp_obj_t *frames;
+    mp_obj_get_array(args[ARG_frames].u_obj, &n, &frames);
+    if (n == 0 || n > 0xFFFF)
+        mp_raise_ValueError(MP_ERROR_TEXT("sequence needs 1 to 65535 frames"));
+
+    anim_seq_obj_t *self = m_new_obj(anim_seq_obj_t);
+    self->base.type = &anim_seq_type;
+    self->n         = n;
+    self->frames    = m_new(mp_obj_t, n);
+    self->durations = m_new(uint16_t, n);
+    self->atlas     = mp_obj_is_int(frames[0]);
+    self->sprite_px = 0;
+
+    // A raw frame is drawn at the size of the CompiledSprite before it, so when
+    // the two are mixed the sprites must share one size that every raw frame
+    // covers
+    const anim_sprite_obj_t *sprite0 = NULL;
+    bool has_raw = false;
+    for (size_t i = 0; i < n && !self->atlas; i++) {
+        if (!mp_obj_is_type(frames[i], &anim_sprite_type)) has_raw = true;
+        else if (!sprite0) sprite0 = MP_OBJ_TO_PTR(frames[i]);
+    }
+    if (sprite0 && has_raw) {
+        for (size_t i = 0; i < n; i++) {
+            if (!mp_obj_is_type(frames[i], &anim_sprite_type)) continue;
+            const anim_sprite_obj_t *sprite = MP_OBJ_TO_PTR(frames[i]);
+            if (sprite->w != sprite0->w || sprite->h != sprite0->h)
+                mp_raise_ValueError(MP_ERROR_TEXT("mixed frames need equal-sized sprites"));
+        }
+        self->sprite_px = (uint32_t)sprite0->w * sprite0->h;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        if (mp_obj_is_int(frames[i]) != self->atlas)
+            mp_raise_ValueError(MP_ERROR_TEXT("frames must be all buffers or all ints"));
+        if (self->atlas) {
+            mp_int_t cell = mp_obj_get_int(frames[i]);
+            if (cell < 0 || cell > 0xFFFF)
+                mp_raise_ValueError(MP_ERROR_TEXT("atlas frame must be 0-65535"));
+            self->frames[i] = MP_OBJ_NEW_SMALL_INT(cell);
+            continue;
+        } else if (!mp_obj_is_type(frames[i], &anim_sprite_type)) {
+            mp_buffer_info_t info;
+            mp_get_buffer_raise(frames[i], &info, MP_BUFFER_READ);
+            if (info.len / 2 < self->sprite_px)
+                mp_raise_ValueError(MP_ERROR_TEXT("frame smaller than the sprite frames"));
+        }
+        self->frames[i] = frames[i];
+    }
+
+    self->alphas = NULL;
+    if (args[ARG_alphas].u_obj != mp_const_none) {
+        size_t    n_alpha;
+        mp_obj_t *alphas;
+        mp_obj_get_array(args[ARG_alphas].u_obj, &n_alpha, &alphas);
+        if (self->atlas)
+            mp_raise_ValueError(MP_ERROR_TEXT("atlas sequences use the sheet's alpha plane"));
+        if (n_alpha != n)
+            mp_raise_ValueError(MP_ERROR_TEXT("need one alpha plane per frame"));
+        self->alphas = m_new(mp_obj_t, n);
+        for (size_t i = 0; i < n; i++) {
+            mp_buffer_info_t info;
+            mp_get_buffer_raise(alphas[i], &info, MP_BUFFER_READ);
+            if (mp_obj_is_type(frames[i], &anim_sprite_type)) {
+                const anim_sprite_obj_t *sprite = MP_OBJ_TO_PTR(frames[i]);
+                if (info.len < (size_t)sprite->w * sprite->h)
+                    mp_raise_ValueError(MP_ERROR_TEXT("alpha buffer too small"));
+            }
+            self->alphas[i] = alphas[i];
+        }
+    }
+
+    mp_obj_t  dur_in = args[ARG_durations].u_obj;
+    size_t    n_dur  = 0;
+    mp_obj_t *dur    = NULL;
+    if (!mp_obj_is_int(dur_in)) {
+        mp_obj_get_array(dur_in, &n_dur, &dur);
+        if (n_dur != n)
+            mp_raise_ValueError(MP_ERROR_TEXT("need one duration per frame"));
+    }
+    for (size_t i = 0; i < n; i++) {
+        int ms = mp_obj_get_int(dur ? dur[i] : dur_in);
+        if (ms < 1 || ms > 0xFFFF)
+            mp_raise_ValueError(MP_ERROR_TEXT("duration must be 1-65535 ms"));
+        self->durations[i] = ms;
+    }
+
+    self->mode = SEQ_LOOP;
+    if (args[ARG_mode].u_obj != mp_const_none) {
+        const char *mode = mp_obj_str_get_str(args[ARG_mode].u_obj);
+        if      (mode[0] == 'l') self->mode = SEQ_LOOP;
+        else if (mode[0] == 'p') self->mode = SEQ_PINGPONG;
+        else if (mode[0] == 'o') self->mode = SEQ_ONCE;
+        else mp_raise_ValueError(MP_ERROR_TEXT("mode must be loop, pingpong or once"));
+    }
+
+    // A ping-pong cycle plays every frame but the two ends twice
+    self->cycle_ms = 0;
+    for (size_t i = 0; i < n; i++)
+        self->cycle_ms += self->durations[i];
+    if (self->mode == SEQ_PINGPONG && n > 1)
+        self->cycle_ms = 2 * self->cycle_ms - self->durations[0] - self->durations[n - 1];
+    return MP_OBJ_FROM_PTR(self);
+}
+
+static void anim_seq_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
+    (void)kind;
+    static const char *const modes[] = { "loop", "pingpong", "once" };
+    anim_seq_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_printf(print, "<Sequence %u frames, %s>", (unsigned)self->n, modes[self->mode]);
+}
+
+#if MICROPY_OBJ_TYPE_REPR == MICROPY_OBJ_TYPE_REPR_SLOT_INDEX
+static MP_DEFINE_CONST_OBJ_TYPE(
+    anim_seq_type, MP_QSTR_Sequence, MP_TYPE_FLAG_NONE,
+    print, anim_seq_print,
+    make_new, anim_seq_make_new);
+#else
+static const mp_obj_type_t anim_seq_type = {
+    { &mp_type_type },
+    .name     = MP_QSTR_Sequence,
+    .print    = anim_seq_print,
+    .make_new = anim_seq_make_new,
+};
+#endif
+
+// Show the slot's current sequence frame
+static void slot_show_seq_frame(sprite_slot_t *slot) {
+    mp_obj_t frame = slot->seq->frames[slot->seq_frame];
+    if (slot->seq->atlas) {
+        slot_set_frame(slot, mp_obj_get_int(frame));
+    } else {
+        // Buffer sequences own the slot's alpha plane: their own per frame,
+        // or none, never a single plane stretched across every frame
+        mp_obj_t alpha = slot->seq->alphas ? slot->seq->alphas[slot->seq_frame] : mp_const_none;
+        slot->alpha       = NULL;
+        slot->alpha_sheet = NULL;
+        if (alpha != mp_const_none) {
+            mp_buffer_info_t info;
+            mp_get_buffer_raise(alpha, &info, MP_BUFFER_READ);
+            slot->alpha_sheet = (const uint8_t *)info.buf;
+            slot->alpha_px    = info.len;
+        }
+        slot_ref_set(slot - slots, SLOT_REF_ALPHA, alpha);
+        slot_set_buf(slot, frame, slot->w, slot->h);
+        if (slot->sprite) layout_dirty = true;
+    }
+}
+
+// Move to the next frame; false when a "once" sequence is already at its end
+static bool seq_step(sprite_slot_t *slot) {
+    const anim_seq_obj_t *seq = slot->seq;
+    int next;
+    switch (seq->mode) {
+        case SEQ_ONCE:
+            if (slot->seq_frame + 1u >= seq->n) return false;
+            next = slot->seq_frame + 1;
+            break;
+        case SEQ_PINGPONG:
+            if (seq->n == 1) return true;
+            next = slot->seq_frame + slot->seq_dir;
+            if (next < 0 || next >= (int)seq->n) {
+                slot->seq_dir = -slot->seq_dir;
+                next = slot->seq_frame + slot->seq_dir;
+            }
+            break;
+        default:
+            next = (slot->seq_frame + 1) % seq->n;
+            break;
+    }
+    slot->seq_frame = next;
+    return true;
+}
+
+// ─── set_slot_anim ───────────────────────────────────────────────────────────
+// set_slot_anim(index, seq)
+// Starts `seq` on the slot at its first frame; None stops on the current one.
+// Atlas sequences use the cells of the slot's set_slot_atlas / set_slot sheet
+// and its alpha plane; buffer sequences replace the plane with their alphas.
+
+static mp_obj_t animation_set_slot_anim(mp_obj_t idx_in, mp_obj_t seq_in) {
+    int idx = mp_obj_get_int(idx_in);
+    if (idx < 0 || idx >= n_slots)
+        mp_raise_ValueError(MP_ERROR_TEXT("slot index out of range"));
+    sprite_slot_t *slot = &slots[idx];
+    if (seq_in == mp_const_none) {
+        slot->seq = NULL;
+        slot_ref_set(idx, SLOT_REF_SEQ, mp_const_none);
+        return mp_const_none;
+    }
+    if (!mp_obj_is_type(seq_in, &anim_seq_type))
+        mp_raise_TypeError(MP_ERROR_TEXT("expected a Sequence"));
+    const anim_seq_obj_t *seq = MP_OBJ_TO_PTR(seq_in);
+
+    if (seq->atlas) {
+        if (slot->sheet == NULL || slot->sprite)
+            mp_raise_ValueError(MP_ERROR_TEXT("slot has no atlas"));
+        uint32_t src_off = slot->src_off;
+        for (size_t i = 0; i < seq->n; i++) {
+            if (!slot_set_frame(slot, mp_obj_get_int(seq->frames[i]))) {
+                slot_set_src(slot, src_off);
+                mp_raise_ValueError(MP_ERROR_TEXT("frame outside the atlas"));
+            }
+        }
+    } else {
+        // Raw frames are drawn at the slot's size until the first compiled
+        // sprite, then at the sprites' size; sprite frames and their planes
+        // were checked by Sequence()
+        size_t need = seq->sprite_px;
+        if (!mp_obj_is_type(seq->frames[0], &anim_sprite_type) && slot->w > 0 && slot->h > 0
+            && (size_t)slot->w * slot->h > need)
+            need = (size_t)slot->w * slot->h;
+        for (size_t i = 0; i < seq->n; i++) {
+            if (mp_obj_is_type(seq->frames[i], &anim_sprite_type)) continue;
+            mp_buffer_info_t info;
+            mp_get_buffer_raise(seq->frames[i], &info, MP_BUFFER_READ);
+            if (info.len / 2 < need)
+                mp_raise_ValueError(MP_ERROR_TEXT("frame smaller than the slot"));
+            if (seq->alphas) {
+                mp_get_buffer_raise(seq->alphas[i], &info, MP_BUFFER_READ);
+                if (info.len < need)
+                    mp_raise_ValueError(MP_ERROR_TEXT("alpha buffer too small"));
+            }
+        }
+    }
+    slot_ref_set(idx, SLOT_REF_SEQ, seq_in);
+    slot->seq         = seq;
+    slot->seq_frame   = 0;
+    slot->seq_dir     = 1;
+    slot->seq_done    = false;
+    slot->seq_elapsed = 0;
+    slot_show_seq_frame(slot);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(animation_set_slot_anim_obj, animation_set_slot_anim);
+
+// ─── slot_anim_done ──────────────────────────────────────────────────────────
+// slot_anim_done(index) -> True once a "once" sequence shows its last frame
+// for its full duration, or when the slot has no sequence
+
+static mp_obj_t animation_slot_anim_done(mp_obj_t idx_in) {
+    int idx = mp_obj_get_int(idx_in);
+    if (idx < 0 || idx >= n_slots)
+        mp_raise_ValueError(MP_ERROR_TEXT("slot index out of range"));
+    return mp_obj_new_bool(slots[idx].seq == NULL || slots[idx].seq_done);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(animation_slot_anim_done_obj, animation_slot_anim_done);
+
+// ─── tick ────────────────────────────────────────────────────────────────────
+// tick(dt_ms) -> number of slots that changed frame
+// Advances every animated slot by dt_ms, skipping frames as needed.
+
+static mp_obj_t animation_tick(mp_obj_t dt_in) {
+    int dt = mp_obj_get_int(dt_in);
+    if (dt < 0) dt = 0;
+    int changed = 0;
+    for (int i = 0; i < n_slots; i++) {
+        sprite_slot_t *slot = &slots[i];
+        if (slot->seq == NULL || slot->seq_done) continue;
+
+        uint16_t start = slot->seq_frame;
+        slot->seq_elapsed += dt;
+        // Whole cycles end where they started; skip them after a long pause
+        if (slot->seq->mode != SEQ_ONCE && slot->seq_elapsed >= slot->seq->cycle_ms)
+            slot->seq_elapsed %= slot->seq->cycle_ms;
+        while (slot->seq_elapsed >= slot->seq->durations[slot->seq_frame]) {
+            slot->seq_elapsed -= slot->seq->durations[slot->seq_frame];
+            if (!seq_step(slot)) {
+                slot->seq_done    = true;
+                slot->seq_elapsed = 0;
+                break;
+            }
+        }
+        if (slot->seq_frame != start) {
+            slot_show_seq_frame(slot);
+            changed++;
+        }
+    }
+    return MP_OBJ_NEW_SMALL_INT(changed);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(animation_tick_obj, animation_tick);
 
 // ─── enable_slot ─────────────────────────────────────────────────────────────
 
 static mp_obj_t animation_enable_slot(size_t n_args, const mp_obj_t *args) {
     int idx = mp_obj_get_int(args[0]);
-    if (idx < 0 || idx >= MAX_SLOTS)
+    if (idx < 0 || idx >= n_slots)
         mp_raise_ValueError(MP_ERROR_TEXT("slot index out of range"));
     slots[idx].enabled = mp_obj_is_true(args[1]);
+    layout_dirty       = true;
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(animation_enable_slot_obj, 2, 2, animation_enable_slot);
 
+// ─── set_slot_z ──────────────────────────────────────────────────────────────
+// set_slot_z(index, z)  higher z draws on top; equal z keeps index order
+
+static mp_obj_t animation_set_slot_z(mp_obj_t idx_in, mp_obj_t z_in) {
+    int idx = mp_obj_get_int(idx_in);
+    if (idx < 0 || idx >= n_slots)
+        mp_raise_ValueError(MP_ERROR_TEXT("slot index out of range"));
+    int z = mp_obj_get_int(z_in);
+    if (z < INT16_MIN) z = INT16_MIN;
+    if (z > INT16_MAX) z = INT16_MAX;
+    if (slots[idx].z != z) {
+        slots[idx].z = (int16_t)z;
+        order_dirty  = true;
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(animation_set_slot_z_obj, animation_set_slot_z);
+
 // ─── set_slot_opacity ────────────────────────────────────────────────────────
 // set_slot_opacity(index, opacity)  opacity: 0 = invisible, 255 = fully opaque
 
 static mp_obj_t animation_set_slot_opacity(mp_obj_t idx_in, mp_obj_t opacity_in) {
     int idx = mp_obj_get_int(idx_in);
-    if (idx < 0 || idx >= MAX_SLOTS)
+    if (idx < 0 || idx >= n_slots)
         mp_raise_ValueError(MP_ERROR_TEXT("slot index out of range"));
     int op = mp_obj_get_int(opacity_in);
     if (op < 0)   op = 0;
@@ -195,6 +899,35 @@ static mp_obj_t animation_set_slot_opacity(mp_obj_t idx_in, mp_obj_t opacity_in)
 }
 static MP_DEFINE_CONST_FUN_OBJ_2(animation_set_slot_opacity_obj, animation_set_slot_opacity);
 
+// ─── set_slot_alpha ──────────────────────────────────────────────────────────
+// set_slot_alpha(index, alpha)
+// alpha: w*h bytes, one 0–255 alpha value per pixel, or None to go back to
+// the MAGIC_COLOR key. Replaces the key for this slot; opacity still applies.
+// For an atlas slot the plane has the sheet's layout and follows its frames.
+
+static mp_obj_t animation_set_slot_alpha(mp_obj_t idx_in, mp_obj_t alpha_in) {
+    int idx = mp_obj_get_int(idx_in);
+    if (idx < 0 || idx >= n_slots)
+        mp_raise_ValueError(MP_ERROR_TEXT("slot index out of range"));
+    sprite_slot_t *slot = &slots[idx];
+    if (alpha_in == mp_const_none) {
+        slot->alpha       = NULL;
+        slot->alpha_sheet = NULL;
+        slot_ref_set(idx, SLOT_REF_ALPHA, mp_const_none);
+        return mp_const_none;
+    }
+    mp_buffer_info_t info;
+    mp_get_buffer_raise(alpha_in, &info, MP_BUFFER_READ);
+    if (info.len < slot_src_extent(slot, slot->src_off))
+        mp_raise_ValueError(MP_ERROR_TEXT("alpha buffer too small"));
+    slot->alpha_sheet = (const uint8_t *)info.buf;
+    slot->alpha_px    = info.len;
+    slot->alpha       = slot->alpha_sheet + slot->src_off;
+    slot_ref_set(idx, SLOT_REF_ALPHA, alpha_in);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(animation_set_slot_alpha_obj, animation_set_slot_alpha);
+
 // ─── set_slot_clip ───────────────────────────────────────────────────────────
 // set_slot_clip(index, clip_x, clip_x_dir, clip_y, clip_y_dir)
 // clip_x / clip_y: pixel coordinate cutoff; 0 = disabled
@@ -203,7 +936,7 @@ static MP_DEFINE_CONST_FUN_OBJ_2(animation_set_slot_opacity_obj, animation_set_s
 
 static mp_obj_t animation_set_slot_clip(size_t n_args, const mp_obj_t *args) {
     int idx = mp_obj_get_int(args[0]);
-    if (idx < 0 || idx >= MAX_SLOTS)
+    if (idx < 0 || idx >= n_slots)
         mp_raise_ValueError(MP_ERROR_TEXT("slot index out of range"));
 
     int16_t     clip_x = (int16_t)mp_obj_get_int(args[1]);
@@ -231,7 +964,7 @@ static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(animation_set_slot_clip_obj, 5, 5, an
 
 static mp_obj_t animation_set_slot_crop(size_t n_args, const mp_obj_t *args) {
     int idx = mp_obj_get_int(args[0]);
-    if (idx < 0 || idx >= MAX_SLOTS)
+    if (idx < 0 || idx >= n_slots)
         mp_raise_ValueError(MP_ERROR_TEXT("slot index out of range"));
 
     int16_t     x0     = (int16_t)mp_obj_get_int(args[1]);
@@ -256,7 +989,297 @@ static mp_obj_t animation_set_slot_crop(size_t n_args, const mp_obj_t *args) {
 static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(animation_set_slot_crop_obj, 7, 7, animation_set_slot_crop);
 // ─── Internal blit ───────────────────────────────────────────────────────────
 
-static void blit_slot(sprite_slot_t *slot, uint8_t *dst) {
+// Opacity blends work on two native RGB565 pixels packed in one 32-bit word
+// (first pixel in the low half), with opacity reduced to 0–32. Masking the
+// word with 0x07E0F81F leaves the low pixel's red and blue and the high
+// pixel's green, each with room above it for a 5-bit product, and the word
+// shifted right by 5 and masked with 0x07C0F83F holds the other three
+// channels the same way. Two multiply-adds then blend all six channels, and
+// the result stays within one LSB of the 8-bit per-channel lerp.
+static inline uint32_t blend2(uint32_t s, uint32_t d, uint32_t a) {
+    uint32_t ia = 32 - a;
+    uint32_t lo = (((s & 0x07E0F81F) * a + (d & 0x07E0F81F) * ia) >> 5) & 0x07E0F81F;
+    uint32_t hi = (((s >> 5) & 0x07C0F83F) * a + ((d >> 5) & 0x07C0F83F) * ia) & 0xF81F07E0;
+    return lo | hi;
+}
+
+static inline uint32_t blend_alpha5(uint8_t opacity) {
+    return (opacity + 4) >> 3;
+}
+
+// Swap the bytes of both 16-bit halves: big-endian buffer pairs <-> native
+static inline uint32_t swap16x2(uint32_t w) {
+    return ((w & 0x00FF00FF) << 8) | ((w >> 8) & 0x00FF00FF);
+}
+
+// Blend one big-endian RGB565 pixel over another.
+// Note: lsb_first display — bytes are stored swapped
+static inline void blend_pixel(uint8_t *d, const uint8_t *s, uint8_t opacity) {
+    uint32_t out = blend2((s[0] << 8) | s[1], (d[0] << 8) | d[1], blend_alpha5(opacity));
+    d[0] = (uint8_t)(out >> 8);
+    d[1] = (uint8_t)(out & 0xFF);
+}
+
+// Blend n big-endian RGB565 pixels over d, two per 32-bit word when both
+// rows are halfword aligned.
+static void blend_span(uint8_t *d, const uint8_t *s, int n, uint8_t opacity) {
+    if ((((uintptr_t)d | (uintptr_t)s) & 1) == 0) {
+        uint32_t        a   = blend_alpha5(opacity);
+        uint16_t       *d16 = (uint16_t *)d;
+        const uint16_t *s16 = (const uint16_t *)s;
+        for (; n >= 2; n -= 2, d16 += 2, s16 += 2) {
+            uint32_t sw  = swap16x2(s16[0] | ((uint32_t)s16[1] << 16));
+            uint32_t dw  = swap16x2(d16[0] | ((uint32_t)d16[1] << 16));
+            uint32_t out = swap16x2(blend2(sw, dw, a));
+            d16[0] = (uint16_t)out;
+            d16[1] = (uint16_t)(out >> 16);
+        }
+        d = (uint8_t *)d16;
+        s = (const uint8_t *)s16;
+    }
+    for (; n > 0; n--, d += 2, s += 2)
+        blend_pixel(d, s, opacity);
+}
+
+// Full-precision blend: unpack each channel, lerp with the full 8-bit
+// opacity, repack. Used for per-pixel alpha, where 33 levels would band soft
+// edges and shadows, and as the reference for bench_blend and blit_slot_ref.
+// Note: lsb_first display — bytes are stored swapped
+static inline void blend_pixel_ref(uint8_t *d, const uint8_t *s, uint8_t opacity) {
+    uint16_t s16 = (s[0] << 8) | s[1];
+    uint16_t d16 = (d[0] << 8) | d[1];
+
+    uint32_t sr = (s16 >> 11) & 0x1F;
+    uint32_t sg = (s16 >>  5) & 0x3F;
+    uint32_t sb =  s16        & 0x1F;
+
+    uint32_t dr = (d16 >> 11) & 0x1F;
+    uint32_t dg = (d16 >>  5) & 0x3F;
+    uint32_t db =  d16        & 0x1F;
+
+    uint32_t a  = opacity;
+    uint32_t ia = 255 - a;
+
+    uint32_t or_ = (sr * a + dr * ia) >> 8;
+    uint32_t og  = (sg * a + dg * ia) >> 8;
+    uint32_t ob  = (sb * a + db * ia) >> 8;
+
+    uint16_t out = (uint16_t)((or_ << 11) | (og << 5) | ob);
+    d[0] = (uint8_t)(out >> 8);
+    d[1] = (uint8_t)(out & 0xFF);
+}
+
+// What of a slot survives the display edges, the band, clip and crop. Every
+// test is constant for the whole draw, so it is reduced once per slot and the
+// inner loops only walk visible pixels.
+typedef struct {
+    int     row0, row1;        // visible source rows [row0, row1)
+    int     hide_y0, hide_y1;  // screen rows hidden by a "between" crop_y (empty if hide_y0 > hide_y1)
+    int     n_spans;
+    int16_t x0[2], x1[2];      // visible screen columns [x0, x1)
+} slot_view_t;
+
+// Visible screen columns of a slot after the display edges, clip_x and
+// crop_x, as up to two [x0, x1) spans. Returns the number of spans.
+static int slot_x_spans(const sprite_slot_t *slot, int16_t x0[2], int16_t x1[2]) {
+    int a = slot->x > 0 ? slot->x : 0;
+    int b = slot->x + slot->w < display_w ? slot->x + slot->w : display_w;
+
+    if (slot->clip_x_enabled) {
+        if (slot->clip_x_after) { if (b > slot->clip_x) b = slot->clip_x; }
+        else                    { if (a < slot->clip_x) a = slot->clip_x; }
+    }
+    if (slot->crop_x_enabled && !slot->crop_x_between) {
+        if (a < slot->crop_x0)     a = slot->crop_x0;
+        if (b > slot->crop_x1 + 1) b = slot->crop_x1 + 1;
+    }
+    if (a >= b) return 0;
+
+    int n = 0;
+    if (slot->crop_x_enabled && slot->crop_x_between && slot->crop_x0 <= slot->crop_x1) {
+        // Hiding [crop_x0, crop_x1] may split the span in two; an inverted
+        // range hides nothing
+        if (a < slot->crop_x0) {
+            x0[n] = a;
+            x1[n] = slot->crop_x0 < b ? slot->crop_x0 : b;
+            n++;
+        }
+        if (b > slot->crop_x1 + 1) {
+            x0[n] = slot->crop_x1 + 1 > a ? slot->crop_x1 + 1 : a;
+            x1[n] = b;
+            n++;
+        }
+        return n;
+    }
+    x0[0] = a;
+    x1[0] = b;
+    return 1;
+}
+
+// Fills `v` for the screen rows [band_y0, band_y1). Returns false when
+// nothing of the slot is visible there.
+static bool slot_view(const sprite_slot_t *slot, int band_y0, int band_y1, slot_view_t *v) {
+    if (slot->opacity == 0) return false;
+    v->n_spans = slot_x_spans(slot, v->x0, v->x1);
+    if (v->n_spans == 0) return false;
+
+    int a = slot->y > band_y0 ? slot->y : band_y0;
+    int b = slot->y + slot->h < band_y1 ? slot->y + slot->h : band_y1;
+    if (a < 0)         a = 0;
+    if (b > display_h) b = display_h;
+
+    if (slot->clip_y_enabled) {
+        if (slot->clip_y_after) { if (b > slot->clip_y) b = slot->clip_y; }
+        else                    { if (a < slot->clip_y) a = slot->clip_y; }
+    }
+    v->hide_y0 = 1;
+    v->hide_y1 = 0;
+    if (slot->crop_y_enabled) {
+        if (slot->crop_y_between) {
+            v->hide_y0 = slot->crop_y0;
+            v->hide_y1 = slot->crop_y1;
+        } else {
+            if (a < slot->crop_y0)     a = slot->crop_y0;
+            if (b > slot->crop_y1 + 1) b = slot->crop_y1 + 1;
+        }
+    }
+    if (a >= b) return false;
+    v->row0 = a - slot->y;
+    v->row1 = b - slot->y;
+    return true;
+}
+
+// Composites one slot into the screen rows [band_y0, band_y1). `dst` holds
+// just those rows, display_w pixels each; draw_all passes the whole screen.
+
+static void blit_slot(sprite_slot_t *slot, uint8_t *dst, int band_y0, int band_y1) {
+    slot_view_t v;
+    if (!slot_view(slot, band_y0, band_y1, &v)) return;
+
+    int16_t  ox      = slot->x;
+    uint8_t  opacity = slot->opacity;
+    const uint8_t key_hi = MAGIC_COLOR >> 8, key_lo = MAGIC_COLOR & 0xFF;
+
+    for (int row = v.row0; row < v.row1; row++) {
+        int target_row = slot->y + row;
+        if (target_row >= v.hide_y0 && target_row <= v.hide_y1) continue;
+
+        uint8_t       *drow = dst + (target_row - band_y0) * display_w * 2;
+        const uint8_t *srow = slot->buf + row * slot->stride * 2;
+
+        for (int i = 0; i < v.n_spans; i++) {
+            const uint8_t *s = srow + (v.x0[i] - ox) * 2;
+            uint8_t       *d = drow + v.x0[i] * 2;
+            int            n = v.x1[i] - v.x0[i];
+
+            if (opacity == 255) {
+                // Fast path — fully opaque, direct copy
+                for (; n > 0; n--, s += 2, d += 2) {
+                    if (s[0] == key_hi && s[1] == key_lo) continue;
+                    d[0] = s[0];
+                    d[1] = s[1];
+                }
+            } else {
+                // Blend each run of non-key pixels as one span
+                while (n > 0) {
+                    int run = 0;
+                    while (run < n && !(s[run * 2] == key_hi && s[run * 2 + 1] == key_lo)) run++;
+                    blend_span(d, s, run, opacity);
+                    n -= run;
+                    s += run * 2;
+                    d += run * 2;
+                    for (; n > 0 && s[0] == key_hi && s[1] == key_lo; n--, s += 2, d += 2) {}
+                }
+            }
+        }
+    }
+}
+
+// Compiled-sprite version of blit_slot: whole opaque runs are copied with
+// memcpy (or blended) and transparent pixels are never read.
+static void blit_sprite_runs(sprite_slot_t *slot, uint8_t *dst, int band_y0, int band_y1) {
+    slot_view_t v;
+    if (!slot_view(slot, band_y0, band_y1, &v)) return;
+
+    const anim_sprite_obj_t *sp = slot->sprite;
+    int16_t  ox      = slot->x;
+    uint8_t  opacity = slot->opacity;
+
+    for (int row = v.row0; row < v.row1; row++) {
+        int target_row = slot->y + row;
+        if (target_row >= v.hide_y0 && target_row <= v.hide_y1) continue;
+
+        uint8_t       *drow = dst + (target_row - band_y0) * display_w * 2;
+        const uint8_t *srow = sp->pixels + row * sp->w * 2;
+
+        for (uint32_t k = sp->row_run[row]; k < sp->row_run[row + 1]; k++) {
+            int rx0 = ox + sp->runs[k * 2];
+            int rx1 = rx0 + sp->runs[k * 2 + 1];
+            for (int i = 0; i < v.n_spans; i++) {
+                int a = rx0 > v.x0[i] ? rx0 : v.x0[i];
+                int b = rx1 < v.x1[i] ? rx1 : v.x1[i];
+                if (a >= b) continue;
+                if (opacity == 255) {
+                    memcpy(drow + a * 2, srow + (a - ox) * 2, (b - a) * 2);
+                } else {
+                    blend_span(drow + a * 2, srow + (a - ox) * 2, b - a, opacity);
+                }
+            }
+        }
+    }
+}
+
+// Per-pixel alpha version of blit_slot. Runs of alpha 0 are skipped and runs
+// of alpha 255 are copied with memcpy; only partial-alpha pixels are blended,
+// one at a time at full 8-bit precision. The slot's opacity scales every
+// alpha value.
+static void blit_slot_alpha(sprite_slot_t *slot, uint8_t *dst, int band_y0, int band_y1) {
+    slot_view_t v;
+    if (!slot_view(slot, band_y0, band_y1, &v)) return;
+
+    int16_t  ox      = slot->x;
+    uint8_t  opacity = slot->opacity;
+
+    for (int row = v.row0; row < v.row1; row++) {
+        int target_row = slot->y + row;
+        if (target_row >= v.hide_y0 && target_row <= v.hide_y1) continue;
+
+        uint8_t       *drow = dst + (target_row - band_y0) * display_w * 2;
+        const uint8_t *srow = slot->buf + row * slot->stride * 2;
+        const uint8_t *arow = slot->alpha + row * slot->stride;
+
+        for (int i = 0; i < v.n_spans; i++) {
+            int x = v.x0[i];
+            while (x < v.x1[i]) {
+                uint8_t a   = arow[x - ox];
+                int     end = x + 1;
+                if (a == 0 || a == 255) {
+                    while (end < v.x1[i] && arow[end - ox] == a) end++;
+                }
+                if (a == 255 && opacity == 255) {
+                    memcpy(drow + x * 2, srow + (x - ox) * 2, (end - x) * 2);
+                } else if (a == 255) {
+                    blend_span(drow + x * 2, srow + (x - ox) * 2, end - x, opacity);
+                } else if (a != 0) {
+                    uint8_t op = opacity == 255 ? a : (uint8_t)((a * opacity + 127) / 255);
+                    blend_pixel_ref(drow + x * 2, srow + (x - ox) * 2, op);
+                }
+                x = end;
+            }
+        }
+    }
+}
+
+static inline void composite_slot(sprite_slot_t *slot, uint8_t *dst, int band_y0, int band_y1) {
+    if (slot->alpha)       blit_slot_alpha(slot, dst, band_y0, band_y1);
+    else if (slot->sprite) blit_sprite_runs(slot, dst, band_y0, band_y1);
+    else                   blit_slot(slot, dst, band_y0, band_y1);
+}
+
+#if ANIMATION_BENCH
+// The original per-pixel compositor, kept as a reference for bench_draw_all:
+// every pixel re-tests the screen edges, clip and crop.
+static void blit_slot_ref(sprite_slot_t *slot, uint8_t *dst, int band_y0, int band_y1) {
     uint8_t *src     = slot->buf;
     int16_t  sw      = slot->w;
     int16_t  sh      = slot->h;
@@ -264,7 +1287,12 @@ static void blit_slot(sprite_slot_t *slot, uint8_t *dst) {
     int16_t  oy      = slot->y;
     uint8_t  opacity = slot->opacity;
 
-    for (int row = 0; row < sh; row++) {
+    int row0 = band_y0 - oy;
+    int row1 = band_y1 - oy;
+    if (row0 < 0)  row0 = 0;
+    if (row1 > sh) row1 = sh;
+
+    for (int row = row0; row < row1; row++) {
         int target_row = oy + row;
         if (target_row < 0 || target_row >= display_h) continue;
 
@@ -277,8 +1305,8 @@ static void blit_slot(sprite_slot_t *slot, uint8_t *dst) {
             if (slot->crop_y_between ? inside : !inside) continue;
         }
 
-        int src_row_base = row * sw * 2;
-        int dst_row_base = target_row * display_w * 2;
+        int src_row_base = row * slot->stride * 2;
+        int dst_row_base = (target_row - band_y0) * display_w * 2;
 
         for (int col = 0; col < sw; col++) {
             int target_col = ox + col;
@@ -304,48 +1332,276 @@ static void blit_slot(sprite_slot_t *slot, uint8_t *dst) {
                 dst[di]     = src[si];
                 dst[di + 1] = src[si + 1];
             } else if (opacity > 0) {
-                // Blend path — unpack RGB565, lerp, repack
-                // Note: lsb_first display — bytes are stored swapped
-                uint16_t s16 = (src[si] << 8) | src[si + 1];
-                uint16_t d16 = (dst[di] << 8) | dst[di + 1];
-
-                uint32_t sr = (s16 >> 11) & 0x1F;
-                uint32_t sg = (s16 >>  5) & 0x3F;
-                uint32_t sb =  s16        & 0x1F;
-
-                uint32_t dr = (d16 >> 11) & 0x1F;
-                uint32_t dg = (d16 >>  5) & 0x3F;
-                uint32_t db =  d16        & 0x1F;
+                blend_pixel_ref(dst + di, src + si, opacity);
+            }
+            // opacity == 0: skip pixel entirely
+        }
+    }
+}
+#endif
 
-                uint32_t a  = opacity;
-                uint32_t ia = 255 - a;
+// ─── compile_sprite ──────────────────────────────────────────────────────────
+// compile_sprite(buf, w, h) -> CompiledSprite
+// Scans a w×h RGB565 sprite once for runs of non-MAGIC_COLOR pixels. Pass the
+// result anywhere a slot takes a buffer; the pixels are still read from `buf`,
+// so recompile if its transparent areas change.
 
-                uint32_t or_ = (sr * a + dr * ia) >> 8;
-                uint32_t og  = (sg * a + dg * ia) >> 8;
-                uint32_t ob  = (sb * a + db * ia) >> 8;
+static mp_obj_t animation_compile_sprite(mp_obj_t buf_in, mp_obj_t w_in, mp_obj_t h_in) {
+    mp_buffer_info_t info;
+    mp_get_buffer_raise(buf_in, &info, MP_BUFFER_READ);
+    int w = mp_obj_get_int(w_in);
+    int h = mp_obj_get_int(h_in);
+    if (w <= 0 || h <= 0 || w > INT16_MAX || h > INT16_MAX)
+        mp_raise_ValueError(MP_ERROR_TEXT("invalid sprite size"));
+    if (info.len < (size_t)(w * h * 2))
+        mp_raise_ValueError(MP_ERROR_TEXT("buffer too small"));
+    const uint8_t *px = (const uint8_t *)info.buf;
+
+    // First pass counts the runs, second records them
+    size_t n_runs = 0;
+    for (int row = 0; row < h; row++) {
+        bool in_run = false;
+        for (int col = 0; col < w; col++) {
+            int  si     = (row * w + col) * 2;
+            bool opaque = ((px[si] << 8) | px[si + 1]) != MAGIC_COLOR;
+            if (opaque && !in_run) n_runs++;
+            in_run = opaque;
+        }
+    }
 
-                uint16_t out = (uint16_t)((or_ << 11) | (og << 5) | ob);
-                dst[di]     = (uint8_t)(out >> 8);
-                dst[di + 1] = (uint8_t)(out & 0xFF);
+    anim_sprite_obj_t *sp = m_new_obj(anim_sprite_obj_t);
+    sp->base.type = &anim_sprite_type;
+    sp->src       = buf_in;
+    sp->pixels    = (uint8_t *)info.buf;
+    sp->w         = w;
+    sp->h         = h;
+    sp->n_runs    = n_runs;
+    sp->row_run   = m_new(uint32_t, h + 1);
+    sp->runs      = m_new(uint16_t, n_runs ? n_runs * 2 : 2);
+
+    size_t k = 0;
+    for (int row = 0; row < h; row++) {
+        sp->row_run[row] = k;
+        int start = -1;
+        for (int col = 0; col <= w; col++) {
+            bool opaque = false;
+            if (col < w) {
+                int si = (row * w + col) * 2;
+                opaque = ((px[si] << 8) | px[si + 1]) != MAGIC_COLOR;
+            }
+            if (opaque && start < 0) {
+                start = col;
+            } else if (!opaque && start >= 0) {
+                sp->runs[k * 2]     = start;
+                sp->runs[k * 2 + 1] = col - start;
+                k++;
+                start = -1;
             }
-            // opacity == 0: skip pixel entirely
         }
     }
+    sp->row_run[h] = k;
+    return MP_OBJ_FROM_PTR(sp);
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(animation_compile_sprite_obj, animation_compile_sprite);
+
+static void anim_sprite_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
+    (void)kind;
+    anim_sprite_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_printf(print, "<CompiledSprite %dx%d, runs=%u>", self->w, self->h, (unsigned)self->n_runs);
 }
 
+#if MICROPY_OBJ_TYPE_REPR == MICROPY_OBJ_TYPE_REPR_SLOT_INDEX
+static MP_DEFINE_CONST_OBJ_TYPE(
+    anim_sprite_type, MP_QSTR_CompiledSprite, MP_TYPE_FLAG_NONE,
+    print, anim_sprite_print);
+#else
+static const mp_obj_type_t anim_sprite_type = {
+    { &mp_type_type },
+    .name  = MP_QSTR_CompiledSprite,
+    .print = anim_sprite_print,
+};
+#endif
+
 // ─── draw_all ────────────────────────────────────────────────────────────────
 
+static void draw_all_into(uint8_t *dst) {
+    layout_update(bucket_rows > 0 ? bucket_rows : BUCKET_ROWS);
+    for (int k = 0; k < draw_count; k++)
+        composite_slot(&slots[draw_list[k]], dst, 0, display_h);
+}
+
 static mp_obj_t animation_draw_all(mp_obj_t display_buf_in) {
     mp_buffer_info_t info;
     mp_get_buffer_raise(display_buf_in, &info, MP_BUFFER_WRITE);
+    draw_all_into((uint8_t *)info.buf);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(animation_draw_all_obj, animation_draw_all);
+
+#if ANIMATION_BENCH
+// Largest per-channel difference between two big-endian RGB565 buffers
+static int rgb565_max_diff(const uint8_t *a, const uint8_t *b, size_t pixels) {
+    int worst = 0;
+    for (size_t i = 0; i < pixels; i++) {
+        int pa = (a[i * 2] << 8) | a[i * 2 + 1];
+        int pb = (b[i * 2] << 8) | b[i * 2 + 1];
+        int dr = abs((pa >> 11) - (pb >> 11));
+        int dg = abs(((pa >> 5) & 0x3F) - ((pb >> 5) & 0x3F));
+        int db = abs((pa & 0x1F) - (pb & 0x1F));
+        if (dr > worst) worst = dr;
+        if (dg > worst) worst = dg;
+        if (db > worst) worst = db;
+    }
+    return worst;
+}
+
+// bench_draw_all(display_buf, scratch_buf, iterations) -> (ref_us, new_us, match)
+// Runs the raw-buffer slots of the current scene through the original
+// per-pixel compositor and the interval one, `iterations` times each, starting
+// both from the contents of display_buf. match is True when both produced the
+// same frame, within one LSB per channel where slots are blended; the new
+// frame is left in display_buf.
+
+static mp_obj_t animation_bench_draw_all(mp_obj_t display_buf_in, mp_obj_t scratch_in, mp_obj_t iters_in) {
+    mp_buffer_info_t info, scratch;
+    mp_get_buffer_raise(display_buf_in, &info, MP_BUFFER_WRITE);
+    mp_get_buffer_raise(scratch_in, &scratch, MP_BUFFER_WRITE);
+    size_t len = (size_t)display_w * display_h * 2;
+    if (info.len < len || scratch.len < len)
+        mp_raise_ValueError(MP_ERROR_TEXT("buffers must cover the display"));
+    int iters = mp_obj_get_int(iters_in);
+    if (iters < 1) iters = 1;
     uint8_t *dst = (uint8_t *)info.buf;
-    for (int i = 0; i < MAX_SLOTS; i++) {
-        if (!slots[i].enabled || slots[i].buf == NULL) continue;
-        blit_slot(&slots[i], dst);
+    uint8_t *ref = (uint8_t *)scratch.buf;
+    memcpy(ref, dst, len);
+    layout_update(bucket_rows > 0 ? bucket_rows : BUCKET_ROWS);
+
+    mp_uint_t t0 = mp_hal_ticks_us();
+    for (int n = 0; n < iters; n++)
+        for (int k = 0; k < draw_count; k++)
+            blit_slot_ref(&slots[draw_list[k]], ref, 0, display_h);
+    mp_uint_t t1 = mp_hal_ticks_us();
+    for (int n = 0; n < iters; n++)
+        for (int k = 0; k < draw_count; k++)
+            blit_slot(&slots[draw_list[k]], dst, 0, display_h);
+    mp_uint_t t2 = mp_hal_ticks_us();
+
+    mp_obj_t result[3] = {
+        mp_obj_new_int_from_uint(t1 - t0),
+        mp_obj_new_int_from_uint(t2 - t1),
+        mp_obj_new_bool(rgb565_max_diff(ref, dst, len / 2) <= 1),
+    };
+    return mp_obj_new_tuple(3, result);
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(animation_bench_draw_all_obj, animation_bench_draw_all);
+
+// bench_blend(pixels) -> (ref_us, swar_us, max_err)
+// Blends two pseudo-random rows of `pixels` pixels at every opacity 1–254
+// with the 8-bit reference and with blend_span. max_err is the largest
+// per-channel difference between the two; it must not exceed 1.
+
+static mp_obj_t animation_bench_blend(mp_obj_t pixels_in) {
+    int n = mp_obj_get_int(pixels_in);
+    if (n < 1) n = 1;
+    uint8_t *src  = m_new(uint8_t, n * 2);
+    uint8_t *base = m_new(uint8_t, n * 2);
+    uint8_t *ref  = m_new(uint8_t, n * 2);
+    uint8_t *out  = m_new(uint8_t, n * 2);
+
+    uint32_t seed = 0x12345678;
+    for (int i = 0; i < n * 2; i++) {
+        seed    = seed * 1664525 + 1013904223;
+        src[i]  = seed >> 24;
+        base[i] = seed >> 16;
+    }
+
+    mp_uint_t ref_us = 0, swar_us = 0;
+    int worst = 0;
+    for (int op = 1; op < 255; op++) {
+        memcpy(ref, base, n * 2);
+        memcpy(out, base, n * 2);
+        mp_uint_t t0 = mp_hal_ticks_us();
+        for (int i = 0; i < n; i++)
+            blend_pixel_ref(ref + i * 2, src + i * 2, op);
+        mp_uint_t t1 = mp_hal_ticks_us();
+        blend_span(out, src, n, op);
+        mp_uint_t t2 = mp_hal_ticks_us();
+        ref_us  += t1 - t0;
+        swar_us += t2 - t1;
+        int err = rgb565_max_diff(ref, out, n);
+        if (err > worst) worst = err;
     }
+
+    m_del(uint8_t, src,  n * 2);
+    m_del(uint8_t, base, n * 2);
+    m_del(uint8_t, ref,  n * 2);
+    m_del(uint8_t, out,  n * 2);
+
+    mp_obj_t result[3] = {
+        mp_obj_new_int_from_uint(ref_us),
+        mp_obj_new_int_from_uint(swar_us),
+        MP_OBJ_NEW_SMALL_INT(worst),
+    };
+    return mp_obj_new_tuple(3, result);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(animation_bench_blend_obj, animation_bench_blend);
+#endif
+
+// ─── render ──────────────────────────────────────────────────────────────────
+// render(tft, background)
+// fill_background + draw_all + tft.blit_buffer without a display_buf: the
+// screen is composed one band of rows at a time straight into the display's
+// DMA buffers, and each band is sent while the next one is composed.
+// background: full-screen RGB565 buffer, or an int colour for a solid fill.
+
+static mp_obj_t animation_render(mp_obj_t tft_in, mp_obj_t background_in) {
+    if (!mp_obj_is_type(tft_in, &anim_display_type))
+        mp_raise_TypeError(MP_ERROR_TEXT("tft must be an esp_lcd.ESPLCD object"));
+    anim_display_obj_t *tft = MP_OBJ_TO_PTR(tft_in);
+    if (tft->width != display_w || tft->height != display_h)
+        mp_raise_ValueError(MP_ERROR_TEXT("display size does not match set_display_size"));
+
+    const uint8_t *bg = NULL;
+    uint8_t bg_hi = 0, bg_lo = 0;
+    if (mp_obj_is_int(background_in)) {
+        int color = mp_obj_get_int(background_in);
+        bg_hi = (color >> 8) & 0xFF;
+        bg_lo =  color       & 0xFF;
+    } else {
+        mp_buffer_info_t bg_info;
+        mp_get_buffer_raise(background_in, &bg_info, MP_BUFFER_READ);
+        if (bg_info.len < (size_t)(display_w * display_h * 2))
+            mp_raise_ValueError(MP_ERROR_TEXT("background must cover the display"));
+        bg = (const uint8_t *)bg_info.buf;
+    }
+
+    int band_rows = anim_display_band_begin(tft);
+    int row_bytes = display_w * 2;
+    layout_update(band_rows);
+
+    for (int y0 = 0; y0 < display_h; y0 += band_rows) {
+        int y1 = y0 + band_rows;
+        if (y1 > display_h) y1 = display_h;
+        uint8_t *band = (uint8_t *)anim_display_band_buffer(tft);
+
+        if (bg) {
+            memcpy(band, bg + y0 * row_bytes, (y1 - y0) * row_bytes);
+        } else {
+            for (int i = 0; i < (y1 - y0) * row_bytes; i += 2) {
+                band[i]     = bg_hi;
+                band[i + 1] = bg_lo;
+            }
+        }
+        int b = y0 / band_rows;
+        for (uint32_t k = bucket_start[b]; k < bucket_start[b + 1]; k++)
+            composite_slot(&slots[bucket_items[k]], band, y0, y1);
+
+        anim_display_band_send(tft, (uint16_t *)band, y1 - y0);
+    }
+    anim_display_band_end(tft);
     return mp_const_none;
 }
-static MP_DEFINE_CONST_FUN_OBJ_1(animation_draw_all_obj, animation_draw_all);
+static MP_DEFINE_CONST_FUN_OBJ_2(animation_render_obj, animation_render);
 
 // ─── fill_background ─────────────────────────────────────────────────────────
 
@@ -408,17 +1664,7 @@ static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(animation_flip_buf_vertical_obj, 4, 4
 // ─── fill_rect ───────────────────────────────────────────────────────────────
 // fill_rect(display_buf, x, y, w, h, color)
 
-static mp_obj_t animation_fill_rect(size_t n_args, const mp_obj_t *args) {
-    mp_buffer_info_t info;
-    mp_get_buffer_raise(args[0], &info, MP_BUFFER_WRITE);
-    uint8_t *buf = (uint8_t *)info.buf;
-
-    int x     = mp_obj_get_int(args[1]);
-    int y     = mp_obj_get_int(args[2]);
-    int w     = mp_obj_get_int(args[3]);
-    int h     = mp_obj_get_int(args[4]);
-    int color = mp_obj_get_int(args[5]);
-
+static void draw_fill_rect(uint8_t *buf, int x, int y, int w, int h, int color) {
     uint8_t hi = (color >> 8) & 0xFF;
     uint8_t lo =  color       & 0xFF;
 
@@ -426,7 +1672,7 @@ static mp_obj_t animation_fill_rect(size_t n_args, const mp_obj_t *args) {
     if (y < 0) { h += y; y = 0; }
     if (x + w > display_w) w = display_w - x;
     if (y + h > display_h) h = display_h - y;
-    if (w <= 0 || h <= 0) return mp_const_none;
+    if (w <= 0 || h <= 0) return;
 
     for (int row = 0; row < h; row++) {
         int base = (y + row) * display_w * 2 + x * 2;
@@ -435,6 +1681,15 @@ static mp_obj_t animation_fill_rect(size_t n_args, const mp_obj_t *args) {
             buf[base + col * 2 + 1] = lo;
         }
     }
+}
+
+static mp_obj_t animation_fill_rect(size_t n_args, const mp_obj_t *args) {
+    mp_buffer_info_t info;
+    mp_get_buffer_raise(args[0], &info, MP_BUFFER_WRITE);
+    draw_fill_rect((uint8_t *)info.buf,
+        mp_obj_get_int(args[1]), mp_obj_get_int(args[2]),
+        mp_obj_get_int(args[3]), mp_obj_get_int(args[4]),
+        mp_obj_get_int(args[5]));
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(animation_fill_rect_obj, 6, 6, animation_fill_rect);
@@ -479,10 +1734,30 @@ static mp_obj_t animation_scroll(size_t n_args, const mp_obj_t *args) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(animation_scroll_obj, 3, 4, animation_scroll);
 
+// Text argument of write/text: a str, or an int for a single character
+static const byte *text_arg(mp_obj_t text_in, size_t *len, byte *single) {
+    if (mp_obj_is_int(text_in)) {
+        *single = (byte)(mp_obj_get_int(text_in) & 0xFF);
+        *len    = 1;
+        return single;
+    }
+    return (const byte *)mp_obj_str_get_data(text_in, len);
+}
+
 // ─── write (proportional bitmap font) ────────────────────────────────────────
 // write(font, text, x, y, fg, display_buf {, bg=-1})
 // bg = -1 means transparent background (default)
 
+// A proportional font module's globals, looked up once
+typedef struct {
+    const uint8_t *widths;
+    const uint8_t *offsets;
+    const uint8_t *bitmaps;
+    const byte    *map;
+    size_t         map_len;
+    uint8_t        bpp, height, offset_width;
+} write_font_t;
+
 static uint32_t _bs_bit    = 0;
 static uint8_t *_bmap_data = NULL;
 
@@ -496,36 +1771,15 @@ static uint8_t _get_color(uint8_t bpp) {
     return color;
 }
 
-static mp_obj_t animation_write(size_t n_args, const mp_obj_t *args) {
-    // write(font, text, x, y, fg, display_buf {, bg=-1})
-    mp_obj_module_t *font = MP_OBJ_TO_PTR(args[0]);
-
-    const char *text;
-    static char single[2] = {0, 0};
-    if (mp_obj_is_int(args[1])) {
-        single[0] = (char)(mp_obj_get_int(args[1]) & 0xFF);
-        text = single;
-    } else {
-        text = mp_obj_str_get_str(args[1]);
-    }
+static void write_font_load(mp_obj_t font_in, write_font_t *f) {
+    mp_obj_module_t *font = MP_OBJ_TO_PTR(font_in);
+    mp_obj_dict_t   *dict = MP_OBJ_TO_PTR(font->globals);
 
-    int  x  = mp_obj_get_int(args[2]);
-    int  y  = mp_obj_get_int(args[3]);
-    int  fg = mp_obj_get_int(args[4]);
-    int  bg = (n_args > 6) ? mp_obj_get_int(args[6]) : -1;
-    bool transparent_bg = (bg == -1);
-
-    mp_buffer_info_t buf_info;
-    mp_get_buffer_raise(args[5], &buf_info, MP_BUFFER_WRITE);
-    uint16_t *dst = (uint16_t *)buf_info.buf;
-
-    mp_obj_dict_t *dict = MP_OBJ_TO_PTR(font->globals);
-
-    const uint8_t bpp = mp_obj_get_int(
+    f->bpp = mp_obj_get_int(
         mp_obj_dict_get(dict, MP_OBJ_NEW_QSTR(MP_QSTR_BPP)));
-    const uint8_t height = mp_obj_get_int(
+    f->height = mp_obj_get_int(
         mp_obj_dict_get(dict, MP_OBJ_NEW_QSTR(MP_QSTR_HEIGHT)));
-    const uint8_t offset_width = mp_obj_get_int(
+    f->offset_width = mp_obj_get_int(
         mp_obj_dict_get(dict, MP_OBJ_NEW_QSTR(MP_QSTR_OFFSET_WIDTH)));
 
     mp_buffer_info_t widths_info, offsets_info, bitmaps_info;
@@ -539,14 +1793,23 @@ static mp_obj_t animation_write(size_t n_args, const mp_obj_t *args) {
         mp_obj_dict_get(dict, MP_OBJ_NEW_QSTR(MP_QSTR_BITMAPS)),
         &bitmaps_info, MP_BUFFER_READ);
 
-    const uint8_t *widths  = widths_info.buf;
-    const uint8_t *offsets = offsets_info.buf;
-    _bmap_data              = bitmaps_info.buf;
+    f->widths  = widths_info.buf;
+    f->offsets = offsets_info.buf;
+    f->bitmaps = bitmaps_info.buf;
 
     mp_obj_t map_obj = mp_obj_dict_get(dict, MP_OBJ_NEW_QSTR(MP_QSTR_MAP));
-    GET_STR_DATA_LEN(map_obj,  map_data, map_len);
-    GET_STR_DATA_LEN(args[1],  str_data, str_len);
+    GET_STR_DATA_LEN(map_obj, map_data, map_len);
+    f->map     = map_data;
+    f->map_len = map_len;
+}
 
+static void draw_write(uint16_t *dst, const write_font_t *f, const byte *str_data, size_t str_len,
+                       int x, int y, int fg, int bg) {
+    const uint8_t *widths  = f->widths;
+    const uint8_t *offsets = f->offsets;
+    _bmap_data              = (uint8_t *)f->bitmaps;
+
+    bool     transparent_bg = (bg == -1);
     uint16_t fg16 = (uint16_t)fg;
     uint16_t bg16 = (uint16_t)(bg & 0xFFFF);
     int cursor_x  = x;
@@ -556,8 +1819,8 @@ static mp_obj_t animation_write(size_t n_args, const mp_obj_t *args) {
         unichar ch = utf8_get_char(s);
         s = utf8_next_char(s);
 
-        const byte *map_s   = map_data;
-        const byte *map_top = map_data + map_len;
+        const byte *map_s   = f->map;
+        const byte *map_top = f->map + f->map_len;
         uint16_t    char_index = 0;
 
         while (map_s < map_top) {
@@ -569,7 +1832,7 @@ static mp_obj_t animation_write(size_t n_args, const mp_obj_t *args) {
 
                 // Decode bit offset into bitmap data
                 _bs_bit = 0;
-                switch (offset_width) {
+                switch (f->offset_width) {
                     case 1:
                         _bs_bit = offsets[char_index];
                         break;
@@ -584,15 +1847,15 @@ static mp_obj_t animation_write(size_t n_args, const mp_obj_t *args) {
                         break;
                 }
 
-                for (int row = 0; row < height; row++) {
+                for (int row = 0; row < f->height; row++) {
                     int py = y + row;
                     if (py < 0 || py >= display_h) {
                         // consume bits for this row even if off-screen
-                        for (int col = 0; col < char_w; col++) _get_color(bpp);
+                        for (int col = 0; col < char_w; col++) _get_color(f->bpp);
                         continue;
                     }
                     for (int col = 0; col < char_w; col++) {
-                        uint8_t pixel = _get_color(bpp);
+                        uint8_t pixel = _get_color(f->bpp);
                         int px = cursor_x + col;
                         if (px < 0 || px >= display_w) continue;
                         int idx = py * display_w + px;
@@ -609,6 +1872,23 @@ static mp_obj_t animation_write(size_t n_args, const mp_obj_t *args) {
             char_index++;
         }
     }
+}
+
+static mp_obj_t animation_write(size_t n_args, const mp_obj_t *args) {
+    // write(font, text, x, y, fg, display_buf {, bg=-1})
+    write_font_t font;
+    write_font_load(args[0], &font);
+
+    size_t      len;
+    byte        single;
+    const byte *text = text_arg(args[1], &len, &single);
+
+    mp_buffer_info_t buf_info;
+    mp_get_buffer_raise(args[5], &buf_info, MP_BUFFER_WRITE);
+
+    draw_write((uint16_t *)buf_info.buf, &font, text, len,
+        mp_obj_get_int(args[2]), mp_obj_get_int(args[3]), mp_obj_get_int(args[4]),
+        (n_args > 6) ? mp_obj_get_int(args[6]) : -1);
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(animation_write_obj, 6, 7, animation_write);
@@ -617,58 +1897,44 @@ static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(animation_write_obj, 6, 7, animation_
 // text(font, text, x, y, fg, display_buf {, bg=-1})
 // Font format: WIDTH, HEIGHT, FIRST, LAST, FONT keys (fixed-width bitmaps)
 
-static mp_obj_t animation_text(size_t n_args, const mp_obj_t *args) {
-    mp_obj_module_t *font = MP_OBJ_TO_PTR(args[0]);
-
-    const uint8_t *source;
-    size_t         source_len;
-    uint8_t        single_char;
-
-    if (mp_obj_is_int(args[1])) {
-        single_char = (uint8_t)(mp_obj_get_int(args[1]) & 0xFF);
-        source      = &single_char;
-        source_len  = 1;
-    } else {
-        source     = (const uint8_t *)mp_obj_str_get_str(args[1]);
-        source_len  = strlen((const char *)source);
-    }
-
-    int  x  = mp_obj_get_int(args[2]);
-    int  y  = mp_obj_get_int(args[3]);
-    int  fg = mp_obj_get_int(args[4]);
-    int  bg = (n_args > 6) ? mp_obj_get_int(args[6]) : -1;
-    bool transparent_bg = (bg == -1);
-
-    mp_buffer_info_t buf_info;
-    mp_get_buffer_raise(args[5], &buf_info, MP_BUFFER_WRITE);
-    uint16_t *dst = (uint16_t *)buf_info.buf;
-
-    mp_obj_dict_t *dict  = MP_OBJ_TO_PTR(font->globals);
-    const uint8_t  fw    = mp_obj_get_int(mp_obj_dict_get(dict, MP_OBJ_NEW_QSTR(MP_QSTR_WIDTH)));
-    const uint8_t  fh    = mp_obj_get_int(mp_obj_dict_get(dict, MP_OBJ_NEW_QSTR(MP_QSTR_HEIGHT)));
-    const uint8_t  first = mp_obj_get_int(mp_obj_dict_get(dict, MP_OBJ_NEW_QSTR(MP_QSTR_FIRST)));
-    const uint8_t  last  = mp_obj_get_int(mp_obj_dict_get(dict, MP_OBJ_NEW_QSTR(MP_QSTR_LAST)));
+// A fixed-width font module's globals, looked up once
+typedef struct {
+    const uint8_t *data;
+    uint8_t        w, h, first, last;
+} text_font_t;
+
+static void text_font_load(mp_obj_t font_in, text_font_t *f) {
+    mp_obj_module_t *font = MP_OBJ_TO_PTR(font_in);
+    mp_obj_dict_t   *dict = MP_OBJ_TO_PTR(font->globals);
+    f->w     = mp_obj_get_int(mp_obj_dict_get(dict, MP_OBJ_NEW_QSTR(MP_QSTR_WIDTH)));
+    f->h     = mp_obj_get_int(mp_obj_dict_get(dict, MP_OBJ_NEW_QSTR(MP_QSTR_HEIGHT)));
+    f->first = mp_obj_get_int(mp_obj_dict_get(dict, MP_OBJ_NEW_QSTR(MP_QSTR_FIRST)));
+    f->last  = mp_obj_get_int(mp_obj_dict_get(dict, MP_OBJ_NEW_QSTR(MP_QSTR_LAST)));
 
     mp_buffer_info_t font_info;
     mp_get_buffer_raise(
         mp_obj_dict_get(dict, MP_OBJ_NEW_QSTR(MP_QSTR_FONT)),
         &font_info, MP_BUFFER_READ);
-    const uint8_t *font_data = font_info.buf;
+    f->data = font_info.buf;
+}
 
+static void draw_text(uint16_t *dst, const text_font_t *f, const uint8_t *source, size_t source_len,
+                      int x, int y, int fg, int bg) {
+    bool     transparent_bg = (bg == -1);
     uint16_t fg16  = (uint16_t)fg;
     uint16_t bg16  = (uint16_t)(bg & 0xFFFF);
-    uint8_t  wide  = fw / 8;
+    uint8_t  wide  = f->w / 8;
     int      cursor_x = x;
 
     while (source_len--) {
         uint8_t ch = *source++;
-        if (ch >= first && ch <= last) {
-            uint16_t chr_idx = (ch - first) * (fh * wide);
-            for (uint8_t row = 0; row < fh; row++) {
+        if (ch >= f->first && ch <= f->last) {
+            uint16_t chr_idx = (ch - f->first) * (f->h * wide);
+            for (uint8_t row = 0; row < f->h; row++) {
                 int py = y + row;
                 if (py < 0 || py >= display_h) continue;
                 for (uint8_t byte_i = 0; byte_i < wide; byte_i++) {
-                    uint8_t chr_byte = font_data[chr_idx + row * wide + byte_i];
+                    uint8_t chr_byte = f->data[chr_idx + row * wide + byte_i];
                     for (int bit = 7; bit >= 0; bit--) {
                         int px = cursor_x + byte_i * 8 + (7 - bit);
                         if (px < 0 || px >= display_w) continue;
@@ -681,9 +1947,25 @@ static mp_obj_t animation_text(size_t n_args, const mp_obj_t *args) {
                     }
                 }
             }
-            cursor_x += fw;
+            cursor_x += f->w;
         }
     }
+}
+
+static mp_obj_t animation_text(size_t n_args, const mp_obj_t *args) {
+    text_font_t font;
+    text_font_load(args[0], &font);
+
+    size_t      len;
+    byte        single;
+    const byte *text = text_arg(args[1], &len, &single);
+
+    mp_buffer_info_t buf_info;
+    mp_get_buffer_raise(args[5], &buf_info, MP_BUFFER_WRITE);
+
+    draw_text((uint16_t *)buf_info.buf, &font, text, len,
+        mp_obj_get_int(args[2]), mp_obj_get_int(args[3]), mp_obj_get_int(args[4]),
+        (n_args > 6) ? mp_obj_get_int(args[6]) : -1);
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(animation_text_obj, 6, 7, animation_text);
@@ -695,7 +1977,7 @@ static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(animation_text_obj, 6, 7, animation_t
 
 static mp_obj_t animation_recolor_slot(mp_obj_t idx_in, mp_obj_t color_in) {
     int idx = mp_obj_get_int(idx_in);
-    if (idx < 0 || idx >= MAX_SLOTS)
+    if (idx < 0 || idx >= n_slots)
         mp_raise_ValueError(MP_ERROR_TEXT("slot index out of range"));
 
     sprite_slot_t *slot = &slots[idx];
@@ -706,36 +1988,467 @@ static mp_obj_t animation_recolor_slot(mp_obj_t idx_in, mp_obj_t color_in) {
     uint8_t hi    = (color >> 8) & 0xFF;
     uint8_t lo    =  color       & 0xFF;
 
-    int total = slot->w * slot->h;
-    for (int i = 0; i < total; i++) {
-        int      si    = i * 2;
-        uint16_t pixel = ((uint16_t)slot->buf[si] << 8) | slot->buf[si + 1];
-        if (pixel == MAGIC_COLOR) continue;
-        slot->buf[si]     = hi;
-        slot->buf[si + 1] = lo;
+    for (int row = 0; row < slot->h; row++) {
+        uint8_t *p = slot->buf + row * slot->stride * 2;
+        for (int col = 0; col < slot->w; col++, p += 2) {
+            uint16_t pixel = ((uint16_t)p[0] << 8) | p[1];
+            if (pixel == MAGIC_COLOR) continue;
+            p[0] = hi;
+            p[1] = lo;
+        }
     }
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_2(animation_recolor_slot_obj, animation_recolor_slot);
 
+// ═══════════════════════════════════════════════════════════════════════════════
+// ─── Command lists ────────────────────────────────────────────────────────────
+// ═══════════════════════════════════════════════════════════════════════════════
+// A CommandList records slot updates and drawing calls as a compact byte
+// stream; execute(cmdlist, display_buf) replays it in one native call. Each
+// command is an opcode byte followed by 16-bit little-endian arguments; text
+// is stored inline. Buffers and fonts are kept in `refs` and addressed by
+// index, and fonts are resolved to their globals when recorded, so replay
+// does no dict lookups or int unboxing. A list can be replayed every frame.
+
+enum {
+    CMD_UPDATE_SLOT = 1,   // slot, ref, x, y
+    CMD_UPDATE_SLOT_POS,   // slot, x, y
+    CMD_UPDATE_SLOT_BUF,   // slot, ref
+    CMD_ENABLE_SLOT,       // slot, enabled
+    CMD_SET_SLOT_OPACITY,  // slot, opacity
+    CMD_FILL_BACKGROUND,   // ref
+    CMD_FILL_RECT,         // x, y, w, h, color
+    CMD_TEXT,              // font, x, y, fg, has_bg, bg, len, bytes
+    CMD_WRITE,             // font, x, y, fg, has_bg, bg, len, bytes
+    CMD_DRAW_ALL,
+};
+
+typedef struct {
+    mp_obj_t font;
+    bool     proportional;
+    union {
+        text_font_t  text;
+        write_font_t write;
+    };
+} cmd_font_t;
+
+typedef struct {
+    mp_obj_base_t base;
+    uint8_t      *code;
+    size_t        len, alloc;
+    mp_obj_t      refs;        // list of the buffers and fonts used by the commands
+    cmd_font_t   *fonts;
+    size_t        n_fonts, fonts_alloc;
+} anim_cmdlist_obj_t;
+
+static const mp_obj_type_t anim_cmdlist_type;
+
+static uint8_t *cmd_reserve(anim_cmdlist_obj_t *self, size_t n) {
+    if (self->len + n > self->alloc) {
+        size_t alloc = self->alloc * 2;
+        if (alloc < self->len + n) alloc = self->len + n + 32;
+        self->code  = m_renew(uint8_t, self->code, self->alloc, alloc);
+        self->alloc = alloc;
+    }
+    uint8_t *p = self->code + self->len;
+    self->len += n;
+    return p;
+}
+
+// Arguments are stored in 16 bits, so values that would wrap on replay are
+// rejected while recording: coordinates are int16, indices and colours uint16.
+static int cmd_coord(mp_obj_t obj) {
+    mp_int_t v = mp_obj_get_int(obj);
+    if (v < INT16_MIN || v > INT16_MAX)
+        mp_raise_ValueError(MP_ERROR_TEXT("coordinate out of range"));
+    return v;
+}
+
+static int cmd_index(mp_obj_t obj) {
+    mp_int_t v = mp_obj_get_int(obj);
+    if (v < 0 || v > 0xFFFF)
+        mp_raise_ValueError(MP_ERROR_TEXT("index out of range"));
+    return v;
+}
+
+static int cmd_color(mp_obj_t obj) {
+    mp_int_t v = mp_obj_get_int(obj);
+    if (v < 0 || v > 0xFFFF)
+        mp_raise_ValueError(MP_ERROR_TEXT("colour must be 0-65535"));
+    return v;
+}
+
+// Append an opcode and n 16-bit arguments, already range-checked
+static void cmd_emit(anim_cmdlist_obj_t *self, uint8_t op, const int *args, size_t n) {
+    uint8_t *p = cmd_reserve(self, 1 + n * 2);
+    *p++ = op;
+    for (size_t i = 0; i < n; i++) {
+        *p++ =  args[i]       & 0xFF;
+        *p++ = (args[i] >> 8) & 0xFF;
+    }
+}
+
+static int cmd_ref(anim_cmdlist_obj_t *self, mp_obj_t obj) {
+    size_t    n;
+    mp_obj_t *items;
+    mp_obj_list_get(self->refs, &n, &items);
+    for (size_t i = 0; i < n; i++)
+        if (items[i] == obj) return i;
+    if (n >= 0xFFFF)
+        mp_raise_ValueError(MP_ERROR_TEXT("too many buffers in command list"));
+    mp_obj_list_append(self->refs, obj);
+    return n;
+}
+
+static int cmd_font(anim_cmdlist_obj_t *self, mp_obj_t font, bool proportional) {
+    for (size_t i = 0; i < self->n_fonts; i++)
+        if (self->fonts[i].font == font && self->fonts[i].proportional == proportional) return i;
+    if (self->n_fonts >= 0xFF)
+        mp_raise_ValueError(MP_ERROR_TEXT("too many fonts in command list"));
+    if (self->n_fonts == self->fonts_alloc) {
+        size_t alloc = self->fonts_alloc ? self->fonts_alloc * 2 : 2;
+        self->fonts       = m_renew(cmd_font_t, self->fonts, self->fonts_alloc, alloc);
+        self->fonts_alloc = alloc;
+    }
+    cmd_font_t *f  = &self->fonts[self->n_fonts];
+    f->font         = font;
+    f->proportional = proportional;
+    if (proportional) write_font_load(font, &f->write);
+    else              text_font_load(font, &f->text);
+    cmd_ref(self, font);    // keeps the font's buffers alive
+    return self->n_fonts++;
+}
+
+static inline int cmd_s16(const uint8_t **pc) {
+    int v = (int16_t)((*pc)[0] | ((*pc)[1] << 8));
+    *pc += 2;
+    return v;
+}
+
+static inline int cmd_u16(const uint8_t **pc) {
+    int v = (*pc)[0] | ((*pc)[1] << 8);
+    *pc += 2;
+    return v;
+}
+
+static mp_obj_t anim_cmdlist_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    mp_arg_check_num(n_args, n_kw, 0, 0, false);
+    anim_cmdlist_obj_t *self = m_new_obj(anim_cmdlist_obj_t);
+    self->base.type   = &anim_cmdlist_type;
+    self->alloc       = 64;
+    self->code        = m_new(uint8_t, self->alloc);
+    self->len         = 0;
+    self->refs        = mp_obj_new_list(0, NULL);
+    self->fonts       = NULL;
+    self->n_fonts     = 0;
+    self->fonts_alloc = 0;
+    return MP_OBJ_FROM_PTR(self);
+}
+
+static void anim_cmdlist_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
+    (void)kind;
+    anim_cmdlist_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_printf(print, "<CommandList %u bytes>", (unsigned)self->len);
+}
+
+// cl.update_slot(index, buf, x, y)
+static mp_obj_t anim_cmdlist_update_slot(size_t n_args, const mp_obj_t *args) {
+    anim_cmdlist_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    int a[4] = { cmd_index(args[1]), cmd_ref(self, args[2]),
+                 cmd_coord(args[3]), cmd_coord(args[4]) };
+    cmd_emit(self, CMD_UPDATE_SLOT, a, 4);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(anim_cmdlist_update_slot_obj, 5, 5, anim_cmdlist_update_slot);
+
+// cl.update_slot_pos(index, x, y)
+static mp_obj_t anim_cmdlist_update_slot_pos(size_t n_args, const mp_obj_t *args) {
+    int a[3] = { cmd_index(args[1]), cmd_coord(args[2]), cmd_coord(args[3]) };
+    cmd_emit(MP_OBJ_TO_PTR(args[0]), CMD_UPDATE_SLOT_POS, a, 3);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(anim_cmdlist_update_slot_pos_obj, 4, 4, anim_cmdlist_update_slot_pos);
+
+// cl.update_slot_buf(index, buf)
+static mp_obj_t anim_cmdlist_update_slot_buf(mp_obj_t self_in, mp_obj_t idx_in, mp_obj_t buf_in) {
+    anim_cmdlist_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    int a[2] = { cmd_index(idx_in), cmd_ref(self, buf_in) };
+    cmd_emit(self, CMD_UPDATE_SLOT_BUF, a, 2);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(anim_cmdlist_update_slot_buf_obj, anim_cmdlist_update_slot_buf);
+
+// cl.enable_slot(index, enabled)
+static mp_obj_t anim_cmdlist_enable_slot(mp_obj_t self_in, mp_obj_t idx_in, mp_obj_t enabled_in) {
+    int a[2] = { cmd_index(idx_in), mp_obj_is_true(enabled_in) };
+    cmd_emit(MP_OBJ_TO_PTR(self_in), CMD_ENABLE_SLOT, a, 2);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(anim_cmdlist_enable_slot_obj, anim_cmdlist_enable_slot);
+
+// cl.set_slot_opacity(index, opacity)
+static mp_obj_t anim_cmdlist_set_slot_opacity(mp_obj_t self_in, mp_obj_t idx_in, mp_obj_t opacity_in) {
+    int op = mp_obj_get_int(opacity_in);
+    if (op < 0)   op = 0;
+    if (op > 255) op = 255;
+    int a[2] = { cmd_index(idx_in), op };
+    cmd_emit(MP_OBJ_TO_PTR(self_in), CMD_SET_SLOT_OPACITY, a, 2);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(anim_cmdlist_set_slot_opacity_obj, anim_cmdlist_set_slot_opacity);
+
+// cl.fill_background(src)
+static mp_obj_t anim_cmdlist_fill_background(mp_obj_t self_in, mp_obj_t src_in) {
+    anim_cmdlist_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    int a[1] = { cmd_ref(self, src_in) };
+    cmd_emit(self, CMD_FILL_BACKGROUND, a, 1);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(anim_cmdlist_fill_background_obj, anim_cmdlist_fill_background);
+
+// cl.fill_rect(x, y, w, h, color)
+static mp_obj_t anim_cmdlist_fill_rect(size_t n_args, const mp_obj_t *args) {
+    int a[5] = { cmd_coord(args[1]), cmd_coord(args[2]),
+                 cmd_coord(args[3]), cmd_coord(args[4]), cmd_color(args[5]) };
+    cmd_emit(MP_OBJ_TO_PTR(args[0]), CMD_FILL_RECT, a, 5);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(anim_cmdlist_fill_rect_obj, 6, 6, anim_cmdlist_fill_rect);
+
+static void cmdlist_text(size_t n_args, const mp_obj_t *args, uint8_t op) {
+    anim_cmdlist_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    int font = cmd_font(self, args[1], op == CMD_WRITE);
+
+    size_t      len;
+    byte        single;
+    const byte *text = text_arg(args[2], &len, &single);
+    if (len > 0xFFFF)
+        mp_raise_ValueError(MP_ERROR_TEXT("text too long"));
+
+    int bg = -1;
+    if (n_args > 6 && mp_obj_get_int(args[6]) != -1)
+        bg = cmd_color(args[6]);
+    int a[6] = { font, cmd_coord(args[3]), cmd_coord(args[4]),
+                 cmd_color(args[5]), bg != -1, bg };
+    cmd_emit(self, op, a, 6);
+    uint8_t *p = cmd_reserve(self, 2 + len);
+    p[0] =  len       & 0xFF;
+    p[1] = (len >> 8) & 0xFF;
+    memcpy(p + 2, text, len);
+}
+
+// cl.text(font, text, x, y, fg {, bg=-1})
+static mp_obj_t anim_cmdlist_text(size_t n_args, const mp_obj_t *args) {
+    cmdlist_text(n_args, args, CMD_TEXT);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(anim_cmdlist_text_obj, 6, 7, anim_cmdlist_text);
+
+// cl.write(font, text, x, y, fg {, bg=-1})
+static mp_obj_t anim_cmdlist_write(size_t n_args, const mp_obj_t *args) {
+    cmdlist_text(n_args, args, CMD_WRITE);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(anim_cmdlist_write_obj, 6, 7, anim_cmdlist_write);
+
+// cl.draw_all()
+static mp_obj_t anim_cmdlist_draw_all(mp_obj_t self_in) {
+    cmd_emit(MP_OBJ_TO_PTR(self_in), CMD_DRAW_ALL, NULL, 0);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(anim_cmdlist_draw_all_obj, anim_cmdlist_draw_all);
+
+// cl.clear() — drop all commands, buffers and fonts
+static mp_obj_t anim_cmdlist_clear(mp_obj_t self_in) {
+    anim_cmdlist_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    self->len     = 0;
+    self->n_fonts = 0;
+    self->refs    = mp_obj_new_list(0, NULL);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(anim_cmdlist_clear_obj, anim_cmdlist_clear);
+
+static const mp_rom_map_elem_t anim_cmdlist_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_update_slot),      MP_ROM_PTR(&anim_cmdlist_update_slot_obj)      },
+    { MP_ROM_QSTR(MP_QSTR_update_slot_pos),  MP_ROM_PTR(&anim_cmdlist_update_slot_pos_obj)  },
+    { MP_ROM_QSTR(MP_QSTR_update_slot_buf),  MP_ROM_PTR(&anim_cmdlist_update_slot_buf_obj)  },
+    { MP_ROM_QSTR(MP_QSTR_enable_slot),      MP_ROM_PTR(&anim_cmdlist_enable_slot_obj)      },
+    { MP_ROM_QSTR(MP_QSTR_set_slot_opacity), MP_ROM_PTR(&anim_cmdlist_set_slot_opacity_obj) },
+    { MP_ROM_QSTR(MP_QSTR_fill_background),  MP_ROM_PTR(&anim_cmdlist_fill_background_obj)  },
+    { MP_ROM_QSTR(MP_QSTR_fill_rect),        MP_ROM_PTR(&anim_cmdlist_fill_rect_obj)        },
+    { MP_ROM_QSTR(MP_QSTR_text),             MP_ROM_PTR(&anim_cmdlist_text_obj)             },
+    { MP_ROM_QSTR(MP_QSTR_write),            MP_ROM_PTR(&anim_cmdlist_write_obj)            },
+    { MP_ROM_QSTR(MP_QSTR_draw_all),         MP_ROM_PTR(&anim_cmdlist_draw_all_obj)         },
+    { MP_ROM_QSTR(MP_QSTR_clear),            MP_ROM_PTR(&anim_cmdlist_clear_obj)            },
+};
+static MP_DEFINE_CONST_DICT(anim_cmdlist_locals_dict, anim_cmdlist_locals_dict_table);
+
+#if MICROPY_OBJ_TYPE_REPR == MICROPY_OBJ_TYPE_REPR_SLOT_INDEX
+static MP_DEFINE_CONST_OBJ_TYPE(
+    anim_cmdlist_type, MP_QSTR_CommandList, MP_TYPE_FLAG_NONE,
+    print, anim_cmdlist_print,
+    make_new, anim_cmdlist_make_new,
+    locals_dict, &anim_cmdlist_locals_dict);
+#else
+static const mp_obj_type_t anim_cmdlist_type = {
+    { &mp_type_type },
+    .name        = MP_QSTR_CommandList,
+    .print       = anim_cmdlist_print,
+    .make_new    = anim_cmdlist_make_new,
+    .locals_dict = (mp_obj_dict_t *)&anim_cmdlist_locals_dict,
+};
+#endif
+
+static sprite_slot_t *cmd_slot(int idx) {
+    if (idx < 0 || idx >= n_slots)
+        mp_raise_ValueError(MP_ERROR_TEXT("slot index out of range"));
+    return &slots[idx];
+}
+
+// ─── execute ─────────────────────────────────────────────────────────────────
+// execute(cmdlist, display_buf)
+
+static mp_obj_t animation_execute(mp_obj_t cmdlist_in, mp_obj_t display_buf_in) {
+    if (!mp_obj_is_type(cmdlist_in, &anim_cmdlist_type))
+        mp_raise_TypeError(MP_ERROR_TEXT("expected a CommandList"));
+    anim_cmdlist_obj_t *self = MP_OBJ_TO_PTR(cmdlist_in);
+
+    mp_buffer_info_t info;
+    mp_get_buffer_raise(display_buf_in, &info, MP_BUFFER_WRITE);
+    size_t frame_len = (size_t)display_w * display_h * 2;
+    if (info.len < frame_len)
+        mp_raise_ValueError(MP_ERROR_TEXT("display_buf must cover the display"));
+    uint8_t *dst = (uint8_t *)info.buf;
+
+    size_t    n_refs;
+    mp_obj_t *refs;
+    mp_obj_list_get(self->refs, &n_refs, &refs);
+
+    const uint8_t *pc  = self->code;
+    const uint8_t *end = self->code + self->len;
+    while (pc < end) {
+        uint8_t op = *pc++;
+        switch (op) {
+            case CMD_UPDATE_SLOT: {
+                sprite_slot_t *slot = cmd_slot(cmd_u16(&pc));
+                slot_set_buf(slot, refs[cmd_u16(&pc)], slot->w, slot->h);
+                slot->x = cmd_s16(&pc);
+                slot->y = cmd_s16(&pc);
+                layout_dirty = true;
+                break;
+            }
+            case CMD_UPDATE_SLOT_POS: {
+                sprite_slot_t *slot = cmd_slot(cmd_u16(&pc));
+                slot->x = cmd_s16(&pc);
+                slot->y = cmd_s16(&pc);
+                layout_dirty = true;
+                break;
+            }
+            case CMD_UPDATE_SLOT_BUF: {
+                sprite_slot_t *slot = cmd_slot(cmd_u16(&pc));
+                slot_set_buf(slot, refs[cmd_u16(&pc)], slot->w, slot->h);
+                layout_dirty = true;
+                break;
+            }
+            case CMD_ENABLE_SLOT: {
+                sprite_slot_t *slot = cmd_slot(cmd_u16(&pc));
+                slot->enabled = cmd_u16(&pc) != 0;
+                layout_dirty  = true;
+                break;
+            }
+            case CMD_SET_SLOT_OPACITY: {
+                sprite_slot_t *slot = cmd_slot(cmd_u16(&pc));
+                slot->opacity = cmd_u16(&pc);
+                break;
+            }
+            case CMD_FILL_BACKGROUND: {
+                mp_buffer_info_t src;
+                mp_get_buffer_raise(refs[cmd_u16(&pc)], &src, MP_BUFFER_READ);
+                memcpy(dst, src.buf, src.len < frame_len ? src.len : frame_len);
+                break;
+            }
+            case CMD_FILL_RECT: {
+                int x = cmd_s16(&pc), y = cmd_s16(&pc);
+                int w = cmd_s16(&pc), h = cmd_s16(&pc);
+                draw_fill_rect(dst, x, y, w, h, cmd_u16(&pc));
+                break;
+            }
+            case CMD_TEXT:
+            case CMD_WRITE: {
+                const cmd_font_t *font = &self->fonts[cmd_u16(&pc)];
+                int x      = cmd_s16(&pc);
+                int y      = cmd_s16(&pc);
+                int fg     = cmd_u16(&pc);
+                int has_bg = cmd_u16(&pc);
+                int bg     = cmd_u16(&pc);
+                int len    = cmd_u16(&pc);
+                if (!has_bg) bg = -1;
+                if (op == CMD_WRITE) draw_write((uint16_t *)dst, &font->write, pc, len, x, y, fg, bg);
+                else                 draw_text((uint16_t *)dst, &font->text, pc, len, x, y, fg, bg);
+                pc += len;
+                break;
+            }
+            case CMD_DRAW_ALL:
+                draw_all_into(dst);
+                break;
+            default:
+                mp_raise_ValueError(MP_ERROR_TEXT("corrupt command list"));
+        }
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(animation_execute_obj, animation_execute);
+
+// ─── __init__ ────────────────────────────────────────────────────────────────
+// Runs on the first import after every boot or soft reset. The slot pool
+// outlives the VM, so clear every slot: what they pointed at was in the
+// previous heap.
+
+static mp_obj_t animation___init__(void) {
+    MP_STATE_VM(animation_slot_refs) = MP_OBJ_NULL;
+    for (int i = 0; i < n_slots; i++)
+        slot_reset(&slots[i]);
+    order_dirty  = true;
+    layout_dirty = true;
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(animation___init___obj, animation___init__);
+
 // ═══════════════════════════════════════════════════════════════════════════════
 // ─── Module table ─────────────────────────────────────────────────────────────
 // ═══════════════════════════════════════════════════════════════════════════════
 
 static const mp_rom_map_elem_t animation_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__),            MP_ROM_QSTR(MP_QSTR_animation)                 },
+    { MP_ROM_QSTR(MP_QSTR___init__),            MP_ROM_PTR(&animation___init___obj)            },
     // Slot system
     { MP_ROM_QSTR(MP_QSTR_set_display_size),    MP_ROM_PTR(&animation_set_display_size_obj)    },
+    { MP_ROM_QSTR(MP_QSTR_set_slot_count),      MP_ROM_PTR(&animation_set_slot_count_obj)      },
     { MP_ROM_QSTR(MP_QSTR_clear_slots),         MP_ROM_PTR(&animation_clear_slots_obj)         },
     { MP_ROM_QSTR(MP_QSTR_set_slot),            MP_ROM_PTR(&animation_set_slot_obj)            },
     { MP_ROM_QSTR(MP_QSTR_update_slot),         MP_ROM_PTR(&animation_update_slot_obj)         },
     { MP_ROM_QSTR(MP_QSTR_update_slot_pos),     MP_ROM_PTR(&animation_update_slot_pos_obj)     },
+    { MP_ROM_QSTR(MP_QSTR_set_slot_atlas),      MP_ROM_PTR(&animation_set_slot_atlas_obj)      },
+    { MP_ROM_QSTR(MP_QSTR_update_slot_frame),   MP_ROM_PTR(&animation_update_slot_frame_obj)   },
+    { MP_ROM_QSTR(MP_QSTR_Sequence),            MP_ROM_PTR(&anim_seq_type)                     },
+    { MP_ROM_QSTR(MP_QSTR_set_slot_anim),       MP_ROM_PTR(&animation_set_slot_anim_obj)       },
+    { MP_ROM_QSTR(MP_QSTR_slot_anim_done),      MP_ROM_PTR(&animation_slot_anim_done_obj)      },
+    { MP_ROM_QSTR(MP_QSTR_tick),                MP_ROM_PTR(&animation_tick_obj)                },
     { MP_ROM_QSTR(MP_QSTR_update_slot_buf),     MP_ROM_PTR(&animation_update_slot_buf_obj)     },
+    { MP_ROM_QSTR(MP_QSTR_set_slot_z),          MP_ROM_PTR(&animation_set_slot_z_obj)          },
     { MP_ROM_QSTR(MP_QSTR_enable_slot),         MP_ROM_PTR(&animation_enable_slot_obj)         },
     { MP_ROM_QSTR(MP_QSTR_set_slot_opacity),    MP_ROM_PTR(&animation_set_slot_opacity_obj)    },
+    { MP_ROM_QSTR(MP_QSTR_set_slot_alpha),      MP_ROM_PTR(&animation_set_slot_alpha_obj)      },
     { MP_ROM_QSTR(MP_QSTR_set_slot_clip),       MP_ROM_PTR(&animation_set_slot_clip_obj)       },
     { MP_ROM_QSTR(MP_QSTR_set_slot_crop),       MP_ROM_PTR(&animation_set_slot_crop_obj)       },
+    { MP_ROM_QSTR(MP_QSTR_compile_sprite),      MP_ROM_PTR(&animation_compile_sprite_obj)      },
     { MP_ROM_QSTR(MP_QSTR_draw_all),            MP_ROM_PTR(&animation_draw_all_obj)            },
+#if ANIMATION_BENCH
+    { MP_ROM_QSTR(MP_QSTR_bench_draw_all),      MP_ROM_PTR(&animation_bench_draw_all_obj)      },
+    { MP_ROM_QSTR(MP_QSTR_bench_blend),         MP_ROM_PTR(&animation_bench_blend_obj)         },
+#endif
+    { MP_ROM_QSTR(MP_QSTR_render),              MP_ROM_PTR(&animation_render_obj)              },
     { MP_ROM_QSTR(MP_QSTR_fill_background),     MP_ROM_PTR(&animation_fill_background_obj)     },
     { MP_ROM_QSTR(MP_QSTR_flip_buf_horizontal), MP_ROM_PTR(&animation_flip_buf_horizontal_obj) },
     { MP_ROM_QSTR(MP_QSTR_flip_buf_vertical),   MP_ROM_PTR(&animation_flip_buf_vertical_obj)   },
@@ -745,6 +2458,9 @@ static const mp_rom_map_elem_t animation_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_write),               MP_ROM_PTR(&animation_write_obj)               },
     { MP_ROM_QSTR(MP_QSTR_text),                MP_ROM_PTR(&animation_text_obj)                },
     { MP_ROM_QSTR(MP_QSTR_recolor_slot),        MP_ROM_PTR(&animation_recolor_slot_obj)        },
+    // Command lists
+    { MP_ROM_QSTR(MP_QSTR_CommandList),         MP_ROM_PTR(&anim_cmdlist_type)                 },
+    { MP_ROM_QSTR(MP_QSTR_execute),             MP_ROM_PTR(&animation_execute_obj)             },
 };
 static MP_DEFINE_CONST_DICT(animation_module_globals, animation_module_globals_table);
 
@@ -26,9 +26,14 @@
 #include "esp_lcd_panel_vendor.h"
 #include "esp_lcd_panel_ops.h"
 #include "soc/soc_caps.h"
+#include "esp_memory_utils.h"
+#include "esp_attr.h"
+#include "esp_cpu.h"
+#include "esp_timer.h"
 #include "driver/gpio.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
 #include "mphalport.h"
 #include "py/obj.h"
 #include "py/runtime.h"
@@ -41,14 +46,44 @@
 #include <string.h>
 #include <stdbool.h>
 
-// ── DMA completion flag ───────────────────────────────────────────────────────
+#if ANIM_LCD_STATS
+#define STATS_ADD(self, field, n)  ((self)->stats.field += (n))
+#define STATS_CYCLES()             esp_cpu_get_cycle_count()
+#else
+#define STATS_ADD(self, field, n)  ((void)(n))
+#define STATS_CYCLES()             0
+#endif
+
+// ── DMA completion ────────────────────────────────────────────────────────────
+// Registered per ESPLCD with the display object as user_ctx. Each finished
+// colour transfer gives the display's counting semaphore once; transfers
+// complete in the order they were queued, so every take releases the oldest
+// DMA buffer.
+
+static bool lcd_panel_done(esp_lcd_panel_io_handle_t panel_io,
+                           esp_lcd_panel_io_event_data_t *edata,
+                           void *user_ctx) {
+    anim_display_obj_t *self = (anim_display_obj_t *)user_ctx;
+    BaseType_t woken = pdFALSE;
+    xSemaphoreGiveFromISR(self->dma_done, &woken);
+    return woken == pdTRUE;
+}
+
+// ── vertical blank ────────────────────────────────────────────────────────────
+// The TE pin rises as the panel enters its vertical blank; without the pin an
+// esp_timer at te_hz stands in for it. Both give the display's binary vsync
+// semaphore, so waiting on it always means "until the next blank".
 
-volatile bool lcd_panel_active = false;
-bool lcd_panel_done(esp_lcd_panel_io_handle_t panel_io,
-                    esp_lcd_panel_io_event_data_t *edata,
-                    void *user_ctx) {
-    lcd_panel_active = false;
-    return false;
+static void IRAM_ATTR lcd_te_isr(void *arg) {
+    anim_display_obj_t *self = (anim_display_obj_t *)arg;
+    BaseType_t woken = pdFALSE;
+    xSemaphoreGiveFromISR(self->vsync, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+static void lcd_te_timer(void *arg) {
+    anim_display_obj_t *self = (anim_display_obj_t *)arg;
+    xSemaphoreGive(self->vsync);
 }
 
 // ═════════════════════════════════════════════════════════════════════════════
@@ -61,11 +96,12 @@ static void esp_lcd_spi_bus_print(const mp_print_t *print, mp_obj_t self_in, mp_
     mp_printf(print,
         "<SPI_BUS %s, dc=%d, cs=%d, spi_mode=%d, pclk=%d, lcd_cmd_bits=%d, "
         "lcd_param_bits=%d, dc_low_on_data=%d, octal_mode=%d, lsb_first=%d, "
-        "swap_color_bytes=%d>",
+        "swap_color_bytes=%d, trans_queue_depth=%d>",
         self->name, self->dc_gpio_num, self->cs_gpio_num, self->spi_mode,
         self->pclk_hz, self->lcd_cmd_bits, self->lcd_param_bits,
         self->flags.dc_low_on_data, self->flags.octal_mode,
-        self->flags.lsb_first, self->flags.swap_color_bytes);
+        self->flags.lsb_first, self->flags.swap_color_bytes,
+        self->trans_queue_depth);
 }
 
 static mp_obj_t esp_lcd_spi_bus_make_new(const mp_obj_type_t *type,
@@ -75,6 +111,7 @@ static mp_obj_t esp_lcd_spi_bus_make_new(const mp_obj_type_t *type,
         ARG_esp_spi_bus, ARG_spi_host, ARG_dc, ARG_cs, ARG_spi_mode,
         ARG_pclk_hz, ARG_lcd_cmd_bits, ARG_lcd_param_bits,
         ARG_dc_low_on_data, ARG_octal_mode, ARG_lsb_first, ARG_swap_color_bytes,
+        ARG_trans_queue_depth,
     };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_bus,              MP_ARG_OBJ  | MP_ARG_REQUIRED                      },
@@ -89,6 +126,7 @@ static mp_obj_t esp_lcd_spi_bus_make_new(const mp_obj_type_t *type,
         { MP_QSTR_octal_mode,       MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false   } },
         { MP_QSTR_lsb_first,        MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false   } },
         { MP_QSTR_swap_color_bytes, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false   } },
+        { MP_QSTR_trans_queue_depth, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 30       } },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args,
@@ -117,16 +155,18 @@ static mp_obj_t esp_lcd_spi_bus_make_new(const mp_obj_type_t *type,
     self->flags.octal_mode       = args[ARG_octal_mode].u_bool;
     self->flags.lsb_first        = args[ARG_lsb_first].u_bool;
     self->flags.swap_color_bytes = args[ARG_swap_color_bytes].u_bool;
+    self->trans_queue_depth      = args[ARG_trans_queue_depth].u_int;
+    if (self->trans_queue_depth < 1)
+        mp_raise_ValueError(MP_ERROR_TEXT("trans_queue_depth must be positive"));
 
     esp_lcd_panel_io_spi_config_t io_config = {
         .dc_gpio_num         = self->dc_gpio_num,
         .cs_gpio_num         = self->cs_gpio_num,
         .pclk_hz             = self->pclk_hz,
         .spi_mode            = self->spi_mode,
-        .trans_queue_depth   = 30,
+        .trans_queue_depth   = self->trans_queue_depth,
         .lcd_cmd_bits        = self->lcd_cmd_bits,
         .lcd_param_bits      = self->lcd_param_bits,
-        .on_color_trans_done = lcd_panel_done,
         .flags = {
             .dc_low_on_data = self->flags.dc_low_on_data,
             .octal_mode     = self->flags.octal_mode,
@@ -206,8 +246,12 @@ static void apply_rotation(anim_display_obj_t *self) {
     esp_lcd_panel_swap_xy(self->panel_handle, r->swap_xy);
     esp_lcd_panel_mirror(self->panel_handle, r->mirror_x, r->mirror_y);
     esp_lcd_panel_set_gap(self->panel_handle, r->x_gap, r->y_gap);
-    self->width  = r->width;
-    self->height = r->height;
+    self->width    = r->width;
+    self->height   = r->height;
+    self->x_gap    = r->x_gap;
+    self->y_gap    = r->y_gap;
+    self->swap_xy  = r->swap_xy;
+    self->mirror_y = r->mirror_y;
 }
 
 // ── make_new ──────────────────────────────────────────────────────────────────
@@ -218,6 +262,8 @@ static mp_obj_t anim_display_make_new(const mp_obj_type_t *type,
     enum {
         ARG_bus, ARG_width, ARG_height, ARG_reset,
         ARG_rotation, ARG_inversion_mode, ARG_dma_rows, ARG_color_space,
+        ARG_dma_buffers, ARG_queue_depth, ARG_te, ARG_te_hz, ARG_color_depth,
+        ARG_feeder, ARG_feeder_queue,
     };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_bus,            MP_ARG_OBJ  | MP_ARG_REQUIRED                    },
@@ -228,6 +274,13 @@ static mp_obj_t anim_display_make_new(const mp_obj_type_t *type,
         { MP_QSTR_inversion_mode, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = true  } },
         { MP_QSTR_dma_rows,       MP_ARG_INT  | MP_ARG_KW_ONLY, {.u_int  = 16    } },
         { MP_QSTR_color_space,    MP_ARG_INT  | MP_ARG_KW_ONLY, {.u_int  = 0     } },
+        { MP_QSTR_dma_buffers,    MP_ARG_INT  | MP_ARG_KW_ONLY, {.u_int  = 2     } },
+        { MP_QSTR_queue_depth,    MP_ARG_INT  | MP_ARG_KW_ONLY, {.u_int  = 0     } },
+        { MP_QSTR_te,             MP_ARG_INT  | MP_ARG_KW_ONLY, {.u_int  = -1    } },
+        { MP_QSTR_te_hz,          MP_ARG_INT  | MP_ARG_KW_ONLY, {.u_int  = 0     } },
+        { MP_QSTR_color_depth,    MP_ARG_INT  | MP_ARG_KW_ONLY, {.u_int  = 16    } },
+        { MP_QSTR_feeder,         MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false } },
+        { MP_QSTR_feeder_queue,   MP_ARG_INT  | MP_ARG_KW_ONLY, {.u_int  = 4     } },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args,
@@ -235,8 +288,25 @@ static mp_obj_t anim_display_make_new(const mp_obj_type_t *type,
 
     if (!mp_obj_is_type(args[ARG_bus].u_obj, &esp_lcd_spi_bus_type))
         mp_raise_TypeError(MP_ERROR_TEXT("bus must be an esp_lcd.SPI_BUS object"));
-
-    anim_display_obj_t *self   = m_new_obj(anim_display_obj_t);
+    if (args[ARG_dma_buffers].u_int < 1 || args[ARG_dma_buffers].u_int > ANIM_LCD_MAX_DMA_BUFFERS)
+        mp_raise_ValueError(MP_ERROR_TEXT("dma_buffers must be 1-8"));
+
+    // queue_depth: colour transfers kept queued at once, 0 = one per buffer
+    esp_lcd_spi_bus_obj_t *bus = MP_OBJ_TO_PTR(args[ARG_bus].u_obj);
+    mp_int_t queue_depth = args[ARG_queue_depth].u_int;
+    if (queue_depth == 0) queue_depth = args[ARG_dma_buffers].u_int;
+    if (queue_depth < 1 || queue_depth > args[ARG_dma_buffers].u_int)
+        mp_raise_ValueError(MP_ERROR_TEXT("queue_depth must be 1-dma_buffers"));
+    if (queue_depth > bus->trans_queue_depth)
+        mp_raise_ValueError(MP_ERROR_TEXT("queue_depth exceeds the bus trans_queue_depth"));
+    if (args[ARG_te_hz].u_int < 0 || args[ARG_te_hz].u_int > 1000)
+        mp_raise_ValueError(MP_ERROR_TEXT("te_hz must be 0-1000"));
+    if (args[ARG_color_depth].u_int != 16 && args[ARG_color_depth].u_int != 12)
+        mp_raise_ValueError(MP_ERROR_TEXT("color_depth must be 16 or 12"));
+    if (args[ARG_feeder_queue].u_int < 1 || args[ARG_feeder_queue].u_int > ANIM_LCD_MAX_ASYNC_QUEUE)
+        mp_raise_ValueError(MP_ERROR_TEXT("feeder_queue must be 1-8"));
+
+    anim_display_obj_t *self   = m_new_obj_with_finaliser(anim_display_obj_t);
     self->base.type            = &anim_display_type;
     self->bus                  = args[ARG_bus].u_obj;
     self->width                = args[ARG_width].u_int;
@@ -244,24 +314,852 @@ static mp_obj_t anim_display_make_new(const mp_obj_type_t *type,
     self->rst                  = (gpio_num_t)args[ARG_reset].u_int;
     self->rotation             = args[ARG_rotation].u_int % 4;
     self->inversion_mode       = args[ARG_inversion_mode].u_bool;
-    self->dma_rows             = args[ARG_dma_rows].u_int;
+    self->dma_rows_auto        = args[ARG_dma_rows].u_int < 0;
+    self->dma_rows             = self->dma_rows_auto ? 16 : args[ARG_dma_rows].u_int;
+    self->autotune_count       = 0;
     self->color_space          = args[ARG_color_space].u_int;
+    self->color_depth          = args[ARG_color_depth].u_int;
     self->panel_handle         = NULL;
     self->io_handle            = NULL;
-    self->dma_buffer           = NULL;
+    self->dma_buffer_count     = args[ARG_dma_buffers].u_int;
+    self->queue_depth          = queue_depth;
     self->dma_buffer_size      = 0;
+    self->row_buf              = NULL;
+    for (int i = 0; i < ANIM_LCD_MAX_DMA_BUFFERS; i++)
+        self->dma_buffers[i]   = NULL;
+    self->dma_done             = NULL;
+    self->dma_pending          = 0;
+    self->framebuffer          = NULL;
+    self->framebuffer_size     = 0;
+    self->shadow               = NULL;
+    self->shadow_valid         = false;
+    self->scroll_tfa           = 0;
+    self->scroll_height        = 0;
+    self->scroll_offset        = 0;
+    self->stream_w             = 0;
+    self->stream_rows_left     = 0;
+    self->te                   = (gpio_num_t)args[ARG_te].u_int;
+    self->te_hz                = args[ARG_te_hz].u_int;
+#if ANIM_LCD_STATS
+    memset(&self->stats, 0, sizeof(self->stats));
+#endif
+    self->vsync                = NULL;
+    self->vsync_timer          = NULL;
+    self->async_task           = NULL;
+    self->async_queue          = NULL;
+    self->async_done           = NULL;
+    for (int i = 0; i < ANIM_LCD_MAX_ASYNC_QUEUE; i++)
+        self->async_bufs[i]    = MP_OBJ_NULL;
+    self->async_head           = 0;
+    self->async_count          = 0;
+    self->feeder               = args[ARG_feeder].u_bool;
+    self->async_depth          = self->feeder ? args[ARG_feeder_queue].u_int : 1;
+    self->async_err            = ESP_OK;
 
-    esp_lcd_spi_bus_obj_t *bus = MP_OBJ_TO_PTR(self->bus);
     self->swap_color_bytes     = bus->flags.swap_color_bytes;
 
     return MP_OBJ_FROM_PTR(self);
 }
 
+// ── DMA buffers ───────────────────────────────────────────────────────────────
+
+static void dma_buffers_free(anim_display_obj_t *self) {
+    for (int i = 0; i < ANIM_LCD_MAX_DMA_BUFFERS; i++) {
+        if (self->dma_buffers[i]) {
+            heap_caps_free(self->dma_buffers[i]);
+            self->dma_buffers[i] = NULL;
+        }
+    }
+    if (self->row_buf) {
+        heap_caps_free(self->row_buf);
+        self->row_buf = NULL;
+    }
+    self->dma_buffer_size = 0;
+}
+
+static bool dma_buffers_try_alloc(anim_display_obj_t *self) {
+    dma_buffers_free(self);
+    if (self->dma_rows == 0) self->dma_rows = 16;
+    int pixels = self->width * self->dma_rows;
+    // RGB444 bands of an odd width are sent as row pairs (see band_begin), so
+    // hold two of the longest row whichever way the panel is rotated
+    if (self->color_depth == 12 && ((self->width | self->height) & 1)) {
+        int longest = self->width > self->height ? self->width : self->height;
+        if (pixels < 2 * longest) pixels = 2 * longest;
+    }
+    self->dma_buffer_size = ((pixels * sizeof(uint16_t)) + 3) & ~3;
+    for (int i = 0; i < self->dma_buffer_count; i++) {
+        self->dma_buffers[i] = heap_caps_malloc(self->dma_buffer_size, MALLOC_CAP_DMA);
+        if (!self->dma_buffers[i]) {
+            dma_buffers_free(self);
+            return false;
+        }
+    }
+    if (self->color_depth == 12) {
+        int longest = self->width > self->height ? self->width : self->height;
+        self->row_buf = heap_caps_malloc(longest * sizeof(uint16_t),
+                                         MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (!self->row_buf) {
+            dma_buffers_free(self);
+            return false;
+        }
+    }
+    return true;
+}
+
+static void dma_buffers_alloc(anim_display_obj_t *self) {
+    if (!dma_buffers_try_alloc(self))
+        mp_raise_msg(&mp_type_MemoryError, MP_ERROR_TEXT("Failed to allocate DMA buffer"));
+}
+
+// Block until at most `max_pending` colour transfers are still on the wire.
+// On timeout the bookkeeping is reset so the next blit starts clean.
+static esp_err_t dma_wait_pending(anim_display_obj_t *self, int max_pending) {
+    if (self->dma_pending <= max_pending)
+        return ESP_OK;
+    uint32_t t0 = STATS_CYCLES();
+    esp_err_t ret = ESP_OK;
+    while (self->dma_pending > max_pending) {
+        if (xSemaphoreTake(self->dma_done,
+                pdMS_TO_TICKS(ANIM_LCD_DMA_TIMEOUT_MS)) != pdTRUE) {
+            self->dma_pending = 0;
+            ret = ESP_ERR_TIMEOUT;
+            break;
+        }
+        self->dma_pending--;
+    }
+#if ANIM_LCD_STATS
+    uint32_t waited = STATS_CYCLES() - t0;
+    self->stats.wait_cycles += waited;
+    if (waited > self->stats.max_wait_cycles)
+        self->stats.max_wait_cycles = waited;
+#else
+    (void)t0;
+#endif
+    return ret;
+}
+
+// Drop completions left over from a transfer that previously timed out.
+static void dma_reset_pending(anim_display_obj_t *self) {
+    if (self->dma_pending == 0)
+        while (xSemaphoreTake(self->dma_done, 0) == pdTRUE) {}
+}
+
+static void dma_check(esp_err_t ret) {
+    if (ret == ESP_ERR_TIMEOUT)
+        mp_raise_msg(&mp_type_OSError, MP_ERROR_TEXT("DMA transfer timed out"));
+    if (ret == ESP_ERR_INVALID_STATE)
+        mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("No vsync source, set te or te_hz"));
+    if (ret == ESP_ERR_NOT_FINISHED)
+        mp_raise_msg(&mp_type_OSError, MP_ERROR_TEXT("vsync timed out"));
+    if (ret != ESP_OK)
+        mp_raise_msg(&mp_type_OSError, MP_ERROR_TEXT("Failed to draw bitmap"));
+}
+
+// ── vsync ─────────────────────────────────────────────────────────────────────
+
+static void vsync_stop(anim_display_obj_t *self) {
+    if (self->vsync_timer) {
+        esp_timer_stop(self->vsync_timer);
+        esp_timer_delete(self->vsync_timer);
+        self->vsync_timer = NULL;
+    } else if (self->vsync && self->te >= 0) {
+        gpio_isr_handler_remove(self->te);
+        gpio_reset_pin(self->te);
+    }
+    if (self->vsync) {
+        vSemaphoreDelete(self->vsync);
+        self->vsync = NULL;
+    }
+}
+
+// Arm the TE interrupt (and enable TE output on the panel) or the emulation
+// timer. Called from init() after the panel has been reset.
+static void vsync_start(anim_display_obj_t *self) {
+    if (self->te < 0 && self->te_hz == 0)
+        return;
+    self->vsync = xSemaphoreCreateBinary();
+    if (!self->vsync)
+        mp_raise_msg(&mp_type_MemoryError, MP_ERROR_TEXT("Failed to create vsync semaphore"));
+
+    esp_err_t ret;
+    if (self->te >= 0) {
+        gpio_config_t io_conf = {
+            .pin_bit_mask = 1ULL << self->te,
+            .mode         = GPIO_MODE_INPUT,
+            .pull_up_en   = GPIO_PULLUP_DISABLE,
+            .pull_down_en = GPIO_PULLDOWN_DISABLE,
+            .intr_type    = GPIO_INTR_POSEDGE,
+        };
+        ret = gpio_config(&io_conf);
+        if (ret == ESP_OK) {
+            // Already installed by machine.Pin is fine
+            ret = gpio_install_isr_service(0);
+            if (ret == ESP_ERR_INVALID_STATE) ret = ESP_OK;
+        }
+        if (ret == ESP_OK)
+            ret = gpio_isr_handler_add(self->te, lcd_te_isr, self);
+        if (ret == ESP_OK) {
+            const uint8_t mode = 0;   // TE on vertical blank only
+            ret = esp_lcd_panel_io_tx_param(self->io_handle, LCD_CMD_TEON, &mode, 1);
+        }
+    } else {
+        const esp_timer_create_args_t timer_args = {
+            .callback = lcd_te_timer,
+            .arg      = self,
+            .name     = "esplcd_te",
+        };
+        ret = esp_timer_create(&timer_args, &self->vsync_timer);
+        if (ret == ESP_OK)
+            ret = esp_timer_start_periodic(self->vsync_timer, 1000000 / self->te_hz);
+    }
+    if (ret != ESP_OK) {
+        vsync_stop(self);
+        mp_raise_msg(&mp_type_OSError, MP_ERROR_TEXT("Failed to set up vsync"));
+    }
+}
+
+// Block until the start of the next vertical blank. A blank that began
+// before the call does not count.
+static esp_err_t vsync_wait(anim_display_obj_t *self) {
+    if (!self->vsync)
+        return ESP_ERR_INVALID_STATE;
+    xSemaphoreTake(self->vsync, 0);
+    if (xSemaphoreTake(self->vsync, pdMS_TO_TICKS(ANIM_LCD_VSYNC_TIMEOUT_MS)) != pdTRUE)
+        return ESP_ERR_NOT_FINISHED;
+    return ESP_OK;
+}
+
+// ── blit engine ───────────────────────────────────────────────────────────────
+// A blit job is a destination rectangle already clipped to the display plus a
+// pointer to its first source pixel. The engine never raises, so it can run
+// from the async worker task as well as from the MicroPython task.
+
+// Clip a w×h source drawn `scale` times larger at (x, y) to the display and
+// fill in `job`; `*src_pos` gets the offset of the first visible source pixel.
+// Returns false when nothing is visible.
+static bool blit_job_place(anim_display_obj_t *self, anim_blit_job_t *job,
+                           int w, int h, int x, int y, int scale, size_t *src_pos) {
+    // Clip to display bounds, in destination pixels
+    int skip_x = (x < 0) ? -x : 0;
+    int skip_y = (y < 0) ? -y : 0;
+    int dst_x  = (x < 0) ?  0 : x;
+    int dst_y  = (y < 0) ?  0 : y;
+    int blit_w = w * scale - skip_x;
+    int blit_h = h * scale - skip_y;
+    if (dst_x + blit_w > self->width)  blit_w = self->width  - dst_x;
+    if (dst_y + blit_h > self->height) blit_h = self->height - dst_y;
+    if (blit_w <= 0 || blit_h <= 0) return false;
+
+    *src_pos     = (skip_y / scale) * w + skip_x / scale;
+    job->src     = NULL;
+    job->stride  = w;
+    job->x       = dst_x;
+    job->y       = dst_y;
+    job->w       = blit_w;
+    job->h       = blit_h;
+    job->vsync   = false;
+    job->scale   = scale;
+    job->phase_x = skip_x % scale;
+    job->phase_y = skip_y % scale;
+    job->index   = NULL;
+    job->lut     = NULL;
+    return true;
+}
+
+static bool blit_job_clip(anim_display_obj_t *self, const mp_obj_t *args,
+                          anim_blit_job_t *job) {
+    mp_buffer_info_t buf_info;
+    mp_get_buffer_raise(args[0], &buf_info, MP_BUFFER_READ);
+    mp_int_t x = mp_obj_get_int(args[1]);
+    mp_int_t y = mp_obj_get_int(args[2]);
+    mp_int_t w = mp_obj_get_int(args[3]);
+    mp_int_t h = mp_obj_get_int(args[4]);
+
+    if (w <= 0 || h <= 0) return false;
+    if (buf_info.len < (size_t)(w * h * 2))
+        mp_raise_ValueError(MP_ERROR_TEXT("Buffer too small"));
+
+    size_t pos;
+    if (!blit_job_place(self, job, w, h, x, y, 1, &pos))
+        return false;
+    job->src = (const uint16_t *)buf_info.buf + pos;
+    return true;
+}
+
+// Jobs that map source pixels 1:1 onto the screen; only these can be sent
+// straight from the source or compared against the diff shadow.
+static bool blit_job_plain(const anim_blit_job_t *job) {
+    return job->scale <= 1 && !job->lut;
+}
+
+// Contiguous rows that already sit in DMA-capable memory and need no byte swap
+// can be handed to the SPI DMA as they are, skipping the bounce buffers. Both
+// ends are checked so a buffer running out of DMA-capable RAM is copied.
+static bool blit_job_zero_copy(anim_display_obj_t *self, const anim_blit_job_t *job) {
+    return blit_job_plain(job)
+        && self->color_depth == 16
+        && !self->swap_color_bytes
+        && job->stride == job->w
+        && ((uintptr_t)job->src & 3) == 0
+        && esp_ptr_dma_capable(job->src)
+        && esp_ptr_dma_capable((const uint8_t *)job->src + job->w * job->h * sizeof(uint16_t) - 1);
+}
+
+// Set the panel's address window. Every colour transfer up to the next window
+// change streams into it, so a rectangle needs this only once however many
+// chunks it is split into. A new window also ends any open stream.
+static esp_err_t lcd_set_window(anim_display_obj_t *self, int x, int y, int w, int h) {
+    self->stream_rows_left = 0;
+    int x0 = x + self->x_gap, x1 = x0 + w - 1;
+    int y0 = y + self->y_gap, y1 = y0 + h - 1;
+    uint8_t caset[4] = { x0 >> 8, x0 & 0xFF, x1 >> 8, x1 & 0xFF };
+    uint8_t raset[4] = { y0 >> 8, y0 & 0xFF, y1 >> 8, y1 & 0xFF };
+    esp_err_t ret = esp_lcd_panel_io_tx_param(self->io_handle, LCD_CMD_CASET, caset, 4);
+    if (ret == ESP_OK)
+        ret = esp_lcd_panel_io_tx_param(self->io_handle, LCD_CMD_RASET, raset, 4);
+    return ret;
+}
+
+// Queue one colour transfer. The first chunk after lcd_set_window() carries
+// RAMWR (or RAMWRC when resuming a stream); later chunks pass cmd = -1 and are
+// sent without a command phase. Any command makes the panel IO drain its
+// queue first, so command-free chunks are what allow several transfers to be
+// queued back to back.
+static esp_err_t lcd_write_color(anim_display_obj_t *self, int cmd,
+                                 const void *data, size_t len) {
+    esp_err_t ret = esp_lcd_panel_io_tx_color(self->io_handle, cmd, data, len);
+    if (ret != ESP_OK) {
+        dma_wait_pending(self, 0);
+        return ret;
+    }
+    self->dma_pending++;
+    STATS_ADD(self, chunks, 1);
+    STATS_ADD(self, bytes, len);
+    return ESP_OK;
+}
+
+// Return destination row `r` of a job. Plain jobs return the source row
+// itself, in source byte order; anything that needs expanding is written to
+// `scratch` in wire byte order and `scratch` is returned.
+static const uint16_t *blit_job_row(anim_display_obj_t *self, const anim_blit_job_t *job,
+                                    int r, uint16_t *scratch) {
+    if (blit_job_plain(job))
+        return job->src + r * job->stride;
+
+    if (job->lut) {
+        const uint16_t *lut = job->lut;
+        size_t pos = job->index_pos + (size_t)r * job->stride;
+        if (job->bpp == 8) {
+            const uint8_t *s = job->index + pos;
+            for (int c = 0; c < job->w; c++)
+                scratch[c] = lut[s[c]];
+        } else {
+            // Indices are packed MSB first and may straddle a byte boundary
+            unsigned bpp  = job->bpp;
+            unsigned mask = (1u << bpp) - 1;
+            size_t   bit  = pos * bpp;
+            for (int c = 0; c < job->w; c++, bit += bpp) {
+                const uint8_t *b = job->index + (bit >> 3);
+                unsigned off = bit & 7;
+                unsigned v   = b[0] << 8;
+                if (off + bpp > 8) v |= b[1];
+                scratch[c] = lut[(v >> (16 - bpp - off)) & mask];
+            }
+        }
+        return scratch;
+    }
+
+    int n = job->scale;
+    const uint16_t *s = job->src + ((job->phase_y + r) / n) * job->stride;
+    bool swap = self->swap_color_bytes;
+    int  k    = job->phase_x;
+    for (int c = 0; c < job->w; s++) {
+        uint16_t v = swap ? (uint16_t)((*s >> 8) | (*s << 8)) : *s;
+        for (; k < n && c < job->w; k++)
+            scratch[c++] = v;
+        k = 0;
+    }
+    return scratch;
+}
+
+// True when destination rows r - 1 and r come from the same source row, so
+// the expanded row can simply be copied down.
+static bool blit_job_repeat_row(const anim_blit_job_t *job, int r) {
+    return job->scale > 1 && r > 0
+        && (job->phase_y + r) / job->scale == (job->phase_y + r - 1) / job->scale;
+}
+
+// Packs RGB444 two pixels to three bytes (R1G1 B1R2 G2B2), carrying a
+// leftover pixel from one row into the next.
+typedef struct {
+    uint8_t *d;
+    bool     half;
+    uint16_t c0;
+} anim_pack444_t;
+
+static void pack444_row(anim_pack444_t *pk, const uint16_t *s, int w, bool wire_order) {
+    uint8_t *d = pk->d;
+    for (int c = 0; c < w; c++) {
+        uint16_t v  = wire_order ? (uint16_t)((s[c] >> 8) | (s[c] << 8)) : s[c];
+        uint16_t c1 = ((v >> 4) & 0xF00) | ((v >> 3) & 0x0F0) | ((v >> 1) & 0x00F);
+        if (!pk->half) {
+            pk->c0 = c1;
+        } else {
+            d[0] = pk->c0 >> 4;
+            d[1] = (pk->c0 << 4) | (c1 >> 8);
+            d[2] = c1;
+            d += 3;
+        }
+        pk->half = !pk->half;
+    }
+    pk->d = d;
+}
+
+// Flush an odd final pixel, padded with a zero nibble; the panel drops the
+// partial pixel when the next command arrives.
+static void pack444_end(anim_pack444_t *pk) {
+    if (pk->half) {
+        pk->d[0] = pk->c0 >> 4;
+        pk->d[1] = pk->c0 << 4;
+        pk->d += 2;
+        pk->half = false;
+    }
+}
+
+// Send `h` rows of `w` pixels into the current window, `cmd` going with the
+// first chunk only.
+static esp_err_t blit_rows(anim_display_obj_t *self, const anim_blit_job_t *job, int cmd) {
+    esp_err_t ret;
+
+    if (blit_job_zero_copy(self, job)) {
+        ret = lcd_write_color(self, cmd, job->src, job->w * job->h * sizeof(uint16_t));
+        if (ret != ESP_OK)
+            return ret;
+        return dma_wait_pending(self, 0);
+    }
+
+    // Pool of DMA buffers: up to queue_depth filled buffers are queued on the
+    // SPI bus while the next one is copied/byte-swapped. Narrow rectangles pack
+    // more rows into each buffer.
+    int nbufs = self->dma_buffer_count;
+    int slot  = 0;
+    int rows  = (self->dma_buffer_size / sizeof(uint16_t)) / job->w;
+    if (self->color_depth == 12) {
+        // 1.5 bytes per pixel, plus room for a pixel carried in from the
+        // previous chunk
+        rows = ((self->dma_buffer_size - 3) * 2 / 3) / job->w;
+        if (rows < 1)
+            return ESP_ERR_INVALID_SIZE;
+    }
+    // An odd pixel left at the end of a chunk is carried into the next one, so
+    // the continued RAMWR stream never contains a padding nibble
+    anim_pack444_t pk = { 0 };
+
+    for (int row = 0; row < job->h; row += rows) {
+        int chunk = job->h - row;
+        if (chunk > rows) chunk = rows;
+
+        // Wait for a free queue slot; transfers finish in order, so this also
+        // releases the buffer about to be refilled.
+        if ((ret = dma_wait_pending(self, self->queue_depth - 1)) != ESP_OK)
+            return ret;
+        uint16_t *buffer = self->dma_buffers[slot];
+
+        uint32_t t0 = STATS_CYCLES();
+        size_t len;
+        if (self->color_depth == 12) {
+            pk.d = (uint8_t *)buffer;
+            for (int r = 0; r < chunk; r++) {
+                const uint16_t *s = blit_job_row(self, job, row + r, self->row_buf);
+                pack444_row(&pk, s, job->w, s == self->row_buf || !self->swap_color_bytes);
+            }
+            if (row + chunk == job->h)
+                pack444_end(&pk);
+            len = pk.d - (uint8_t *)buffer;
+        } else {
+            for (int r = 0; r < chunk; r++) {
+                uint16_t *d = buffer + r * job->w;
+                if (r > 0 && blit_job_repeat_row(job, row + r)) {
+                    memcpy(d, d - job->w, job->w * sizeof(uint16_t));
+                    continue;
+                }
+                const uint16_t *s = blit_job_row(self, job, row + r, d);
+                if (s == d)
+                    continue;
+                if (self->swap_color_bytes) {
+                    for (int c = 0; c < job->w; c++)
+                        d[c] = ((s[c] >> 8) | (s[c] << 8)) & 0xFFFF;
+                } else {
+                    memcpy(d, s, job->w * sizeof(uint16_t));
+                }
+            }
+            len = chunk * job->w * sizeof(uint16_t);
+        }
+        STATS_ADD(self, copy_cycles, (uint32_t)(STATS_CYCLES() - t0));
+
+        ret = lcd_write_color(self, row == 0 ? cmd : -1, buffer, len);
+        if (ret != ESP_OK)
+            return ret;
+
+        slot = (slot + 1) % nbufs;
+    }
+    return dma_wait_pending(self, 0);
+}
+
+static esp_err_t blit_job_run(anim_display_obj_t *self, const anim_blit_job_t *job) {
+    esp_err_t ret;
+    dma_reset_pending(self);
+    if ((ret = lcd_set_window(self, job->x, job->y, job->w, job->h)) != ESP_OK)
+        return ret;
+    return blit_rows(self, job, LCD_CMD_RAMWR);
+}
+
+// ── shadow frame diff ─────────────────────────────────────────────────────────
+// With diff_mode enabled the display keeps a copy of every pixel it has sent.
+// Each row of a new blit is compared against it and only the changed [x0, x1)
+// span is sent, coalesced over consecutive changed rows into bands of up to
+// dma_rows. A frame with no changes costs no SPI traffic at all. The shadow is
+// trusted only after a full-screen blit has filled it.
+
+static void shadow_invalidate(anim_display_obj_t *self) {
+    self->shadow_valid = false;
+}
+
+static void shadow_free(anim_display_obj_t *self) {
+    if (self->shadow) {
+        heap_caps_free(self->shadow);
+        self->shadow = NULL;
+    }
+    self->shadow_valid = false;
+}
+
+static esp_err_t blit_job_diff(anim_display_obj_t *self, const anim_blit_job_t *job) {
+    esp_err_t ret;
+    uint16_t *shadow = self->shadow + job->y * self->width + job->x;
+
+    if (!self->shadow_valid) {
+        if ((ret = blit_job_run(self, job)) != ESP_OK)
+            return ret;
+        for (int r = 0; r < job->h; r++)
+            memcpy(shadow + r * self->width, job->src + r * job->stride,
+                   job->w * sizeof(uint16_t));
+        self->shadow_valid = (job->w == self->width && job->h == self->height);
+        return ESP_OK;
+    }
+
+    int band_y = -1, band_x0 = 0, band_x1 = 0;
+    for (int r = 0; r <= job->h; r++) {
+        int x0 = 0, x1 = 0;
+        if (r < job->h) {
+            const uint16_t *s = job->src + r * job->stride;
+            uint16_t       *d = shadow + r * self->width;
+            while (x0 < job->w && s[x0] == d[x0]) x0++;
+            if (x0 < job->w) {
+                x1 = job->w;
+                while (s[x1 - 1] == d[x1 - 1]) x1--;
+                memcpy(d + x0, s + x0, (x1 - x0) * sizeof(uint16_t));
+            }
+        }
+        bool changed = x1 > x0;
+
+        if (band_y >= 0 && (!changed || r - band_y >= self->dma_rows)) {
+            anim_blit_job_t band = {
+                .src    = job->src + band_y * job->stride + band_x0,
+                .stride = job->stride,
+                .x      = job->x + band_x0,
+                .y      = job->y + band_y,
+                .w      = band_x1 - band_x0,
+                .h      = r - band_y,
+            };
+            if ((ret = blit_job_run(self, &band)) != ESP_OK) {
+                shadow_invalidate(self);
+                return ret;
+            }
+            band_y = -1;
+        }
+        if (changed) {
+            if (band_y < 0) {
+                band_y  = r;
+                band_x0 = x0;
+                band_x1 = x1;
+            } else {
+                if (x0 < band_x0) band_x0 = x0;
+                if (x1 > band_x1) band_x1 = x1;
+            }
+        }
+    }
+    return ESP_OK;
+}
+
+// Entry point for RGB565 blits that may go through the shadow diff.
+static esp_err_t blit_job_send(anim_display_obj_t *self, const anim_blit_job_t *job) {
+    esp_err_t ret;
+    if (job->vsync && (ret = vsync_wait(self)) != ESP_OK)
+        return ret;
+
+#if ANIM_LCD_STATS
+    int64_t t0 = esp_timer_get_time();
+#endif
+    if (self->shadow && blit_job_plain(job)) {
+        ret = blit_job_diff(self, job);
+    } else {
+        // Expanded blits bypass the shadow, so it no longer matches the panel
+        if (self->shadow)
+            shadow_invalidate(self);
+        ret = blit_job_run(self, job);
+    }
+#if ANIM_LCD_STATS
+    self->stats.blits++;
+    self->stats.busy_us += esp_timer_get_time() - t0;
+#endif
+    return ret;
+}
+
+// ── async worker ──────────────────────────────────────────────────────────────
+// One worker task per display runs the blit engine for blit_buffer_async().
+// Jobs are passed through a queue of async_depth entries and each finished
+// job gives async_done once, in submission order. The source objects stay in
+// self->async_bufs until their job is reclaimed so the GC cannot free them
+// while they are still being read. With feeder=True the task is pinned to the
+// core MicroPython is not running on, so the copy/byte-swap/DMA chunking runs
+// in parallel with Python instead of merely interleaved with it.
+
+static void async_worker(void *arg) {
+    anim_display_obj_t *self = (anim_display_obj_t *)arg;
+    anim_blit_job_t job;
+    for (;;) {
+        xQueueReceive(self->async_queue, &job, portMAX_DELAY);
+        esp_err_t ret = blit_job_send(self, &job);
+        if (ret != ESP_OK && self->async_err == ESP_OK)
+            self->async_err = ret;
+        xSemaphoreGive(self->async_done);
+    }
+}
+
+static void async_start(anim_display_obj_t *self) {
+    if (self->async_task) return;
+    self->async_queue = xQueueCreate(self->async_depth, sizeof(anim_blit_job_t));
+    self->async_done  = xSemaphoreCreateCounting(ANIM_LCD_MAX_ASYNC_QUEUE, 0);
+    BaseType_t ok = pdFALSE;
+    if (self->async_queue && self->async_done) {
+        if (self->feeder) {
+            BaseType_t core = (xPortGetCoreID() + 1) % portNUM_PROCESSORS;
+            ok = xTaskCreatePinnedToCore(async_worker, "esplcd", ANIM_LCD_ASYNC_STACK, self,
+                                         uxTaskPriorityGet(NULL), &self->async_task, core);
+        } else {
+            ok = xTaskCreate(async_worker, "esplcd", ANIM_LCD_ASYNC_STACK, self,
+                             uxTaskPriorityGet(NULL), &self->async_task);
+        }
+    }
+    if (ok != pdPASS) {
+        if (self->async_queue) vQueueDelete(self->async_queue);
+        if (self->async_done)  vSemaphoreDelete(self->async_done);
+        self->async_queue = NULL;
+        self->async_done  = NULL;
+        self->async_task  = NULL;
+        mp_raise_msg(&mp_type_MemoryError, MP_ERROR_TEXT("Failed to start blit task"));
+    }
+}
+
+// Wait for the oldest outstanding job and release its source buffer.
+static void async_reclaim(anim_display_obj_t *self) {
+    xSemaphoreTake(self->async_done, portMAX_DELAY);
+    self->async_bufs[self->async_head] = MP_OBJ_NULL;
+    self->async_head = (self->async_head + 1) % self->async_depth;
+    self->async_count--;
+}
+
+// Return (and clear) the first error recorded by the worker.
+static esp_err_t async_take_err(anim_display_obj_t *self) {
+    esp_err_t ret = self->async_err;
+    self->async_err = ESP_OK;
+    return ret;
+}
+
+// Wait for all outstanding async blits and release their source buffers.
+static esp_err_t async_wait(anim_display_obj_t *self) {
+    while (self->async_count > 0)
+        async_reclaim(self);
+    return async_take_err(self);
+}
+
+// Hand a clipped job to the worker, pinning `buf` until it has been sent.
+// When the queue is full this waits for the oldest job first.
+static esp_err_t async_submit(anim_display_obj_t *self, const anim_blit_job_t *job, mp_obj_t buf) {
+    async_start(self);
+    if (self->async_count == self->async_depth)
+        async_reclaim(self);
+    esp_err_t ret = async_take_err(self);
+    if (ret != ESP_OK)
+        return ret;
+    self->async_bufs[(self->async_head + self->async_count) % self->async_depth] = buf;
+    self->async_count++;
+    xQueueSend(self->async_queue, job, portMAX_DELAY);
+    return ESP_OK;
+}
+
+// Jobs submitted but not finished yet.
+static int async_running(anim_display_obj_t *self) {
+    if (!self->async_done) return 0;
+    return self->async_count - uxSemaphoreGetCount(self->async_done);
+}
+
+static void async_stop(anim_display_obj_t *self) {
+    if (!self->async_task) return;
+    async_wait(self);
+    vTaskDelete(self->async_task);
+    vQueueDelete(self->async_queue);
+    vSemaphoreDelete(self->async_done);
+    self->async_task  = NULL;
+    self->async_queue = NULL;
+    self->async_done  = NULL;
+    self->async_head  = 0;
+}
+
+// ── band output ───────────────────────────────────────────────────────────────
+// The exported band API from esp_lcd.h. The whole screen is one address
+// window; each band is composed directly in a pool buffer in framebuffer byte
+// order and converted in place (byte swap, or RGB444 packing, which only ever
+// writes behind what it has read) before it is queued.
+
+int anim_display_band_begin(anim_display_obj_t *self) {
+    if (!self->panel_handle || !self->dma_buffers[0])
+        mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("Display not initialized"));
+    dma_check(async_wait(self));
+    dma_reset_pending(self);
+    shadow_invalidate(self);
+    dma_check(lcd_set_window(self, 0, 0, self->width, self->height));
+    self->band_slot  = 0;
+    self->band_first = true;
+    int rows = (self->dma_buffer_size / sizeof(uint16_t)) / self->width;
+    // RGB444 packs pixel pairs in place, so bands of an odd width need an even
+    // row count; the pool always holds at least two rows in that case
+    if (self->color_depth == 12 && (self->width & 1))
+        rows &= ~1;
+    return rows;
+}
+
+// Wait for a free queue slot and return the buffer to compose the next band in.
+uint16_t *anim_display_band_buffer(anim_display_obj_t *self) {
+    dma_check(dma_wait_pending(self, self->queue_depth - 1));
+    return self->dma_buffers[self->band_slot];
+}
+
+void anim_display_band_send(anim_display_obj_t *self, uint16_t *band, int rows) {
+    int    n   = rows * self->width;
+    size_t len = n * sizeof(uint16_t);
+    if (self->color_depth == 12) {
+        anim_pack444_t pk = { .d = (uint8_t *)band };
+        pack444_row(&pk, band, n, !self->swap_color_bytes);
+        pack444_end(&pk);
+        len = pk.d - (uint8_t *)band;
+    } else if (self->swap_color_bytes) {
+        for (int i = 0; i < n; i++)
+            band[i] = (band[i] >> 8) | (band[i] << 8);
+    }
+    dma_check(lcd_write_color(self, self->band_first ? LCD_CMD_RAMWR : -1, band, len));
+    self->band_first = false;
+    self->band_slot  = (self->band_slot + 1) % self->dma_buffer_count;
+}
+
+void anim_display_band_end(anim_display_obj_t *self) {
+    dma_check(dma_wait_pending(self, 0));
+#if ANIM_LCD_STATS
+    self->stats.blits++;
+#endif
+}
+
+// ── autotune ──────────────────────────────────────────────────────────────────
+// Size the DMA pool from the free DMA heap, leaving `reserve` bytes for other
+// users (SD card, Wi-Fi), then time full-screen blits at a range of dma_rows
+// and keep the fastest. The calibration frames are drawn black from a single
+// zeroed row (stride 0), which exercises the normal copy path.
+
+// Returns the number of candidates measured into self->autotune_results, 0 if
+// not even one row fits. Leaves the fastest dma_rows allocated (or the
+// previous value if nothing could be measured).
+static int dma_autotune(anim_display_obj_t *self, size_t reserve, int frames) {
+    anim_autotune_result_t *results = self->autotune_results;
+    self->autotune_count = 0;
+    uint16_t prev_rows = self->dma_rows;
+    // Allocated before the pool is freed so a MemoryError leaves it intact
+    uint16_t *row = m_new0(uint16_t, self->width);
+    dma_buffers_free(self);
+    shadow_invalidate(self);
+
+    size_t row_bytes = self->width * sizeof(uint16_t);
+    size_t free_dma  = heap_caps_get_free_size(MALLOC_CAP_DMA);
+    size_t budget    = free_dma > reserve ? (free_dma - reserve) / self->dma_buffer_count : 0;
+    size_t largest   = heap_caps_get_largest_free_block(MALLOC_CAP_DMA);
+    if (budget > largest) budget = largest;
+    int max_rows = budget / row_bytes;
+    if (max_rows > self->height) max_rows = self->height;
+    if (max_rows < 1) {
+        m_del(uint16_t, row, self->width);
+        self->dma_rows = prev_rows;
+        dma_buffers_alloc(self);
+        return 0;
+    }
+
+    // Candidates double from 4 rows and always include max_rows
+    uint16_t cand[ANIM_LCD_AUTOTUNE_STEPS];
+    int n_cand = 0;
+    for (int r = 4; r < max_rows && n_cand < ANIM_LCD_AUTOTUNE_STEPS - 1; r *= 2)
+        cand[n_cand++] = r;
+    cand[n_cand++] = max_rows;
+
+    anim_blit_job_t job = {
+        .src = row, .stride = 0, .x = 0, .y = 0,
+        .w = self->width, .h = self->height, .vsync = false,
+    };
+#if ANIM_LCD_STATS
+    anim_lcd_stats_t saved = self->stats;
+#endif
+
+    int n = 0;
+    uint16_t best_rows = 0;
+    uint32_t best_us   = UINT32_MAX;
+    for (int i = 0; i < n_cand; i++) {
+        self->dma_rows = cand[i];
+        if (!dma_buffers_try_alloc(self))
+            break;
+        dma_reset_pending(self);
+        blit_job_run(self, &job);   // warm-up, not timed
+        int64_t t0 = esp_timer_get_time();
+        esp_err_t ret = ESP_OK;
+        for (int f = 0; f < frames && ret == ESP_OK; f++)
+            ret = blit_job_run(self, &job);
+        if (ret != ESP_OK)
+            break;
+        results[n].rows     = cand[i];
+        results[n].frame_us = (esp_timer_get_time() - t0) / frames;
+        if (results[n].frame_us < best_us) {
+            best_us   = results[n].frame_us;
+            best_rows = cand[i];
+        }
+        n++;
+    }
+
+#if ANIM_LCD_STATS
+    self->stats = saved;
+#endif
+    m_del(uint16_t, row, self->width);
+    self->dma_rows       = n ? best_rows : prev_rows;
+    self->autotune_count = n;
+    dma_buffers_alloc(self);
+    return n;
+}
+
 // ── init ──────────────────────────────────────────────────────────────────────
 
 static mp_obj_t anim_display_init(mp_obj_t self_in) {
     anim_display_obj_t *self = MP_OBJ_TO_PTR(self_in);
 
+    async_stop(self);
+    vsync_stop(self);
+    if (self->dma_done)
+        dma_wait_pending(self, 0);
     if (self->panel_handle) {
         esp_lcd_panel_del(self->panel_handle);
         self->panel_handle = NULL;
@@ -280,49 +1178,211 @@ static mp_obj_t anim_display_init(mp_obj_t self_in) {
     if (ret != ESP_OK)
         mp_raise_msg(&mp_type_OSError, MP_ERROR_TEXT("Failed to create LCD panel"));
 
+    if (!self->dma_done) {
+        self->dma_done = xSemaphoreCreateCounting(ANIM_LCD_MAX_DMA_BUFFERS, 0);
+        if (!self->dma_done)
+            mp_raise_msg(&mp_type_MemoryError, MP_ERROR_TEXT("Failed to create DMA semaphore"));
+    }
+    const esp_lcd_panel_io_callbacks_t cbs = {
+        .on_color_trans_done = lcd_panel_done,
+    };
+    esp_lcd_panel_io_register_event_callbacks(self->io_handle, &cbs, self);
+
     esp_lcd_panel_reset(self->panel_handle);
     esp_lcd_panel_init(self->panel_handle);
+    if (self->color_depth == 12) {
+        // The esp_lcd ST7789 driver only knows 16/18 bpp; override its COLMOD
+        const uint8_t colmod = ST7789_COLMOD_RGB444;
+        esp_lcd_panel_io_tx_param(self->io_handle, LCD_CMD_COLMOD, &colmod, 1);
+    }
     esp_lcd_panel_disp_on_off(self->panel_handle, true);
     esp_lcd_panel_invert_color(self->panel_handle, self->inversion_mode);
+    self->scroll_height = 0;
+    self->scroll_offset = 0;
     apply_rotation(self);
+    if (self->shadow)
+        shadow_invalidate(self);
 
-    if (self->dma_buffer) {
-        heap_caps_free(self->dma_buffer);
-        self->dma_buffer = NULL;
+    dma_buffers_alloc(self);
+    if (self->dma_rows_auto) {
+        dma_autotune(self, ANIM_LCD_AUTOTUNE_RESERVE, 2);
     }
-    if (self->dma_rows == 0) self->dma_rows = 16;
-    self->dma_buffer_size = ((self->width * self->dma_rows * sizeof(uint16_t)) + 3) & ~3;
-    self->dma_buffer = heap_caps_malloc(self->dma_buffer_size, MALLOC_CAP_DMA);
-    if (!self->dma_buffer)
-        mp_raise_msg(&mp_type_MemoryError, MP_ERROR_TEXT("Failed to allocate DMA buffer"));
+    vsync_start(self);
 
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(anim_display_init_obj, anim_display_init);
 
 // ── deinit ────────────────────────────────────────────────────────────────────
-
-static mp_obj_t anim_display_deinit(mp_obj_t self_in) {
-    anim_display_obj_t *self = MP_OBJ_TO_PTR(self_in);
+// Also run by __del__: the TE ISR, emulation timer, DMA callback and feeder
+// task all hold a raw pointer to the object, so none may outlive it.
+
+static void display_teardown(anim_display_obj_t *self) {
+    async_stop(self);
+    vsync_stop(self);
+    if (self->dma_done) {
+        dma_wait_pending(self, 0);
+        const esp_lcd_panel_io_callbacks_t cbs = { .on_color_trans_done = NULL };
+        esp_lcd_panel_io_register_event_callbacks(self->io_handle, &cbs, NULL);
+        vSemaphoreDelete(self->dma_done);
+        self->dma_done = NULL;
+    }
+    shadow_free(self);
     if (self->panel_handle) {
         esp_lcd_panel_del(self->panel_handle);
         self->panel_handle = NULL;
     }
-    if (self->dma_buffer) {
-        heap_caps_free(self->dma_buffer);
-        self->dma_buffer  = NULL;
-        self->dma_buffer_size = 0;
-    }
+    dma_buffers_free(self);
+}
+
+static mp_obj_t anim_display_deinit(mp_obj_t self_in) {
+    display_teardown(MP_OBJ_TO_PTR(self_in));
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(anim_display_deinit_obj, anim_display_deinit);
 
+// ── DMA framebuffer cache ─────────────────────────────────────────────────────
+// dma_framebuffer() hands its memory to Python as a by-ref bytearray, which
+// keeps nothing alive, so the blocks are never freed. A display claims one for
+// its lifetime; once released, the block is reused by the next display asking
+// for the same size (typically the same panel after a soft reset).
+
+typedef struct {
+    uint16_t *buf;
+    size_t    size;
+    bool      claimed;
+} anim_fb_cache_t;
+
+static anim_fb_cache_t fb_cache[ANIM_LCD_MAX_FRAMEBUFFERS];
+
+static uint16_t *fb_cache_claim(size_t size) {
+    anim_fb_cache_t *spare = NULL;
+    for (int i = 0; i < ANIM_LCD_MAX_FRAMEBUFFERS; i++) {
+        anim_fb_cache_t *e = &fb_cache[i];
+        if (e->buf && !e->claimed && e->size == size) {
+            e->claimed = true;
+            return e->buf;
+        }
+        if (!e->buf && !spare)
+            spare = e;
+    }
+    if (!spare)
+        mp_raise_msg(&mp_type_MemoryError, MP_ERROR_TEXT("Too many DMA framebuffers"));
+    spare->buf = heap_caps_calloc(1, size, MALLOC_CAP_DMA);
+    if (!spare->buf)
+        mp_raise_msg(&mp_type_MemoryError, MP_ERROR_TEXT("Failed to allocate DMA framebuffer"));
+    spare->size    = size;
+    spare->claimed = true;
+    return spare->buf;
+}
+
+static void fb_cache_release(uint16_t *buf) {
+    for (int i = 0; i < ANIM_LCD_MAX_FRAMEBUFFERS; i++) {
+        if (fb_cache[i].buf == buf)
+            fb_cache[i].claimed = false;
+    }
+}
+
+// ── __del__ ───────────────────────────────────────────────────────────────────
+// Runs deinit() for displays collected without it (always the case on a soft
+// reset), then gives the dma_framebuffer() block back to the cache; the memory
+// stays valid for any bytearray still pointing into it.
+
+static mp_obj_t anim_display_del(mp_obj_t self_in) {
+    anim_display_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    display_teardown(self);
+    if (self->framebuffer) {
+        fb_cache_release(self->framebuffer);
+        self->framebuffer      = NULL;
+        self->framebuffer_size = 0;
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(anim_display_del_obj, anim_display_del);
+
+// ── vscroll_define / vscroll ──────────────────────────────────────────────────
+// vscroll_define(top, height, bottom)
+// vscroll(offset)
+// Hardware scrolling with the ST7789 VSCRDEF/VSCSAD commands. The panel always
+// scrolls along its frame-memory rows, which is the screen's y axis in
+// portrait rotations and its x axis in landscape ones; top/height/bottom are
+// given along that axis in screen coordinates and must add up to its length.
+// The rotation gap and mirroring are folded in so the same values work in
+// every rotation.
+
+static void vscroll_send(anim_display_obj_t *self, uint16_t tfa, uint16_t vsa, uint16_t vsp) {
+    uint16_t bfa = ST7789_FRAME_LINES - tfa - vsa;
+    uint8_t def[6] = { tfa >> 8, tfa & 0xFF, vsa >> 8, vsa & 0xFF, bfa >> 8, bfa & 0xFF };
+    uint8_t sad[2] = { vsp >> 8, vsp & 0xFF };
+    esp_lcd_panel_io_tx_param(self->io_handle, LCD_CMD_VSCRDEF, def, sizeof(def));
+    esp_lcd_panel_io_tx_param(self->io_handle, LCD_CMD_VSCSAD, sad, sizeof(sad));
+}
+
+static void vscroll_apply(anim_display_obj_t *self) {
+    int h   = self->scroll_height;
+    int off = ((self->scroll_offset % h) + h) % h;
+    // Mirrored panels scan the scroll area bottom-up, so the start address
+    // has to move the other way for content to scroll the same direction.
+    if (self->mirror_y && off) off = h - off;
+    vscroll_send(self, self->scroll_tfa, h, self->scroll_tfa + off);
+}
+
+// Called after a rotation change: the old definition no longer lines up with
+// the new axes, so return the panel to an unscrolled full-frame layout.
+static void vscroll_reset(anim_display_obj_t *self) {
+    if (self->scroll_height == 0) return;
+    self->scroll_height = 0;
+    self->scroll_offset = 0;
+    vscroll_send(self, 0, ST7789_FRAME_LINES, 0);
+}
+
+static mp_obj_t anim_display_vscroll_define(size_t n_args, const mp_obj_t *args) {
+    anim_display_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    if (!self->panel_handle)
+        mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("Display not initialized"));
+
+    mp_int_t top    = mp_obj_get_int(args[1]);
+    mp_int_t height = mp_obj_get_int(args[2]);
+    mp_int_t bottom = mp_obj_get_int(args[3]);
+    int      lines  = self->swap_xy ? self->width : self->height;
+    int      gap    = self->swap_xy ? self->x_gap : self->y_gap;
+    if (top < 0 || height <= 0 || bottom < 0 || top + height + bottom != lines)
+        mp_raise_ValueError(MP_ERROR_TEXT("top + height + bottom must equal the scroll axis length"));
+
+    dma_check(async_wait(self));
+    // Physical frame-memory row of the first scrolling line
+    self->scroll_tfa    = self->mirror_y ? ST7789_FRAME_LINES - gap - top - height : gap + top;
+    self->scroll_height = height;
+    self->scroll_offset = 0;
+    vscroll_apply(self);
+    shadow_invalidate(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(anim_display_vscroll_define_obj, 4, 4, anim_display_vscroll_define);
+
+static mp_obj_t anim_display_vscroll(mp_obj_t self_in, mp_obj_t offset_in) {
+    anim_display_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->scroll_height == 0)
+        mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("Call vscroll_define first"));
+
+    dma_check(async_wait(self));
+    self->scroll_offset = mp_obj_get_int(offset_in);
+    vscroll_apply(self);
+    shadow_invalidate(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(anim_display_vscroll_obj, anim_display_vscroll);
+
 // ── rotation ──────────────────────────────────────────────────────────────────
 
 static mp_obj_t anim_display_rotation(mp_obj_t self_in, mp_obj_t val) {
     anim_display_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    dma_check(async_wait(self));
     self->rotation = mp_obj_get_int(val) % 4;
+    vscroll_reset(self);
     apply_rotation(self);
+    shadow_invalidate(self);
+    self->stream_rows_left = 0;
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_2(anim_display_rotation_obj, anim_display_rotation);
@@ -331,6 +1391,7 @@ static MP_DEFINE_CONST_FUN_OBJ_2(anim_display_rotation_obj, anim_display_rotatio
 
 static mp_obj_t anim_display_inversion_mode(mp_obj_t self_in, mp_obj_t val) {
     anim_display_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    dma_check(async_wait(self));
     self->inversion_mode = mp_obj_is_true(val);
     esp_lcd_panel_invert_color(self->panel_handle, self->inversion_mode);
     return mp_const_none;
@@ -338,65 +1399,518 @@ static mp_obj_t anim_display_inversion_mode(mp_obj_t self_in, mp_obj_t val) {
 static MP_DEFINE_CONST_FUN_OBJ_2(anim_display_inversion_mode_obj, anim_display_inversion_mode);
 
 // ── blit_buffer ───────────────────────────────────────────────────────────────
-// blit_buffer(buf, x, y, w, h)
+// blit_buffer(buf, x, y, w, h, *, vsync=False)
+
+// Parse the positional buf, x, y, w, h and the vsync keyword shared by
+// blit_buffer and blit_buffer_async into `pos` and the returned flag.
+static bool blit_parse_vsync(anim_display_obj_t *self, size_t n_args, const mp_obj_t *pos_args,
+                             mp_map_t *kw_args, mp_obj_t *pos) {
+    enum { ARG_buf, ARG_x, ARG_y, ARG_w, ARG_h, ARG_vsync };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buf,   MP_ARG_OBJ  | MP_ARG_REQUIRED                   },
+        { MP_QSTR_x,     MP_ARG_OBJ  | MP_ARG_REQUIRED                   },
+        { MP_QSTR_y,     MP_ARG_OBJ  | MP_ARG_REQUIRED                   },
+        { MP_QSTR_w,     MP_ARG_OBJ  | MP_ARG_REQUIRED                   },
+        { MP_QSTR_h,     MP_ARG_OBJ  | MP_ARG_REQUIRED                   },
+        { MP_QSTR_vsync, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args,
+        MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    for (int i = ARG_buf; i <= ARG_h; i++)
+        pos[i] = args[i].u_obj;
+    if (args[ARG_vsync].u_bool && !self->vsync)
+        dma_check(ESP_ERR_INVALID_STATE);
+    return args[ARG_vsync].u_bool;
+}
+
+static mp_obj_t anim_display_blit_buffer(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    anim_display_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    if (!self->panel_handle || !self->dma_buffers[0])
+        mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("Display not initialized"));
+
+    mp_obj_t pos[5];
+    bool vsync = blit_parse_vsync(self, n_args, pos_args, kw_args, pos);
+    dma_check(async_wait(self));
+    anim_blit_job_t job;
+    if (blit_job_clip(self, pos, &job)) {
+        job.vsync = vsync;
+        dma_check(blit_job_send(self, &job));
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(anim_display_blit_buffer_obj, 6, anim_display_blit_buffer);
+
+// ── blit_buffer_async ─────────────────────────────────────────────────────────
+// blit_buffer_async(buf, x, y, w, h, *, vsync=False)
+// Same as blit_buffer but returns as soon as the transfer has been handed to
+// the worker task. `buf` must not be modified until wait() returns. With
+// vsync=True the worker, not the caller, waits for the vertical blank. Only
+// when the queue is already full does the call wait for the oldest job.
+
+static mp_obj_t anim_display_blit_buffer_async(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    anim_display_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    if (!self->panel_handle || !self->dma_buffers[0])
+        mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("Display not initialized"));
+
+    mp_obj_t pos[5];
+    bool vsync = blit_parse_vsync(self, n_args, pos_args, kw_args, pos);
+    anim_blit_job_t job;
+    if (!blit_job_clip(self, pos, &job))
+        return mp_const_none;
+    job.vsync = vsync;
+
+    dma_check(async_submit(self, &job, pos[0]));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(anim_display_blit_buffer_async_obj, 6, anim_display_blit_buffer_async);
 
-static mp_obj_t anim_display_blit_buffer(size_t n_args, const mp_obj_t *args) {
+// ── blit_scaled ───────────────────────────────────────────────────────────────
+// blit_scaled(buf, x, y, w, h, scale)
+// Draw a w×h RGB565 buffer `scale` times larger at (x, y). The pixels are
+// duplicated while the DMA buffers are filled, so no full-size copy of the
+// image is ever made.
+
+static mp_obj_t anim_display_blit_scaled(size_t n_args, const mp_obj_t *args) {
     anim_display_obj_t *self = MP_OBJ_TO_PTR(args[0]);
-    if (!self->panel_handle || !self->dma_buffer)
+    if (!self->panel_handle || !self->dma_buffers[0])
         mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("Display not initialized"));
 
     mp_buffer_info_t buf_info;
     mp_get_buffer_raise(args[1], &buf_info, MP_BUFFER_READ);
-    mp_int_t x = mp_obj_get_int(args[2]);
-    mp_int_t y = mp_obj_get_int(args[3]);
-    mp_int_t w = mp_obj_get_int(args[4]);
-    mp_int_t h = mp_obj_get_int(args[5]);
-
+    mp_int_t x     = mp_obj_get_int(args[2]);
+    mp_int_t y     = mp_obj_get_int(args[3]);
+    mp_int_t w     = mp_obj_get_int(args[4]);
+    mp_int_t h     = mp_obj_get_int(args[5]);
+    mp_int_t scale = mp_obj_get_int(args[6]);
+    if (scale < 1 || scale > ANIM_LCD_MAX_SCALE)
+        mp_raise_ValueError(MP_ERROR_TEXT("scale must be 1-8"));
     if (w <= 0 || h <= 0) return mp_const_none;
     if (buf_info.len < (size_t)(w * h * 2))
         mp_raise_ValueError(MP_ERROR_TEXT("Buffer too small"));
 
-    // Clip to display bounds
-    mp_int_t src_x  = (x < 0) ? -x : 0;
-    mp_int_t src_y  = (y < 0) ? -y : 0;
-    mp_int_t dst_x  = (x < 0) ?  0 : x;
-    mp_int_t dst_y  = (y < 0) ?  0 : y;
-    mp_int_t blit_w = w - src_x;
-    mp_int_t blit_h = h - src_y;
-    if (dst_x + blit_w > self->width)  blit_w = self->width  - dst_x;
-    if (dst_y + blit_h > self->height) blit_h = self->height - dst_y;
-    if (blit_w <= 0 || blit_h <= 0) return mp_const_none;
+    dma_check(async_wait(self));
+    anim_blit_job_t job;
+    size_t pos;
+    if (blit_job_place(self, &job, w, h, x, y, scale, &pos)) {
+        job.src = (const uint16_t *)buf_info.buf + pos;
+        dma_check(blit_job_send(self, &job));
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(anim_display_blit_scaled_obj, 7, 7, anim_display_blit_scaled);
 
-    uint16_t *src = (uint16_t *)buf_info.buf + src_y * w + src_x;
+// ── blit_indexed ──────────────────────────────────────────────────────────────
+// blit_indexed(buf, palette, x, y, w, h, bpp[, index])
+// Draw a palettized w×h bitmap: `bpp`-bit indices (1-8) packed MSB first, as
+// written by utils/sprites2bitmap.py, looked up in an RGB565 palette while the
+// DMA buffers are filled. `index` selects the n-th w×h bitmap of a sheet. The
+// palette is copied (and byte-swapped if the bus needs it) once per call.
 
-    for (mp_int_t row = 0; row < blit_h; row += self->dma_rows) {
-        mp_int_t chunk = blit_h - row;
-        if (chunk > self->dma_rows) chunk = self->dma_rows;
+static mp_obj_t anim_display_blit_indexed(size_t n_args, const mp_obj_t *args) {
+    anim_display_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    if (!self->panel_handle || !self->dma_buffers[0])
+        mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("Display not initialized"));
 
-        for (mp_int_t r = 0; r < chunk; r++) {
-            uint16_t *s = src + (row + r) * w;
-            uint16_t *d = self->dma_buffer + r * blit_w;
-            if (self->swap_color_bytes) {
-                for (mp_int_t c = 0; c < blit_w; c++)
-                    d[c] = ((s[c] >> 8) | (s[c] << 8)) & 0xFFFF;
-            } else {
-                memcpy(d, s, blit_w * sizeof(uint16_t));
+    mp_buffer_info_t buf_info;
+    mp_get_buffer_raise(args[1], &buf_info, MP_BUFFER_READ);
+    mp_int_t x     = mp_obj_get_int(args[3]);
+    mp_int_t y     = mp_obj_get_int(args[4]);
+    mp_int_t w     = mp_obj_get_int(args[5]);
+    mp_int_t h     = mp_obj_get_int(args[6]);
+    mp_int_t bpp   = mp_obj_get_int(args[7]);
+    mp_int_t index = (n_args > 8) ? mp_obj_get_int(args[8]) : 0;
+    if (bpp < 1 || bpp > 8)
+        mp_raise_ValueError(MP_ERROR_TEXT("bpp must be 1-8"));
+    if (w <= 0 || h <= 0 || index < 0) return mp_const_none;
+    size_t first = (size_t)index * w * h;
+    if (buf_info.len * 8 < (first + (size_t)w * h) * bpp)
+        mp_raise_ValueError(MP_ERROR_TEXT("Buffer too small"));
+
+    // Palette: array('H') or a list/tuple of ints such as sprites2bitmap's PALETTE
+    int colors = 1 << bpp;
+    uint16_t lut[256];
+    mp_buffer_info_t pal_info;
+    if (mp_get_buffer(args[2], &pal_info, MP_BUFFER_READ)) {
+        if (pal_info.len < colors * sizeof(uint16_t))
+            mp_raise_ValueError(MP_ERROR_TEXT("Palette too small"));
+        memcpy(lut, pal_info.buf, colors * sizeof(uint16_t));
+    } else {
+        size_t   count;
+        mp_obj_t *items;
+        mp_obj_get_array(args[2], &count, &items);
+        if (count < (size_t)colors)
+            mp_raise_ValueError(MP_ERROR_TEXT("Palette too small"));
+        for (int i = 0; i < colors; i++)
+            lut[i] = mp_obj_get_int(items[i]);
+    }
+    if (self->swap_color_bytes) {
+        for (int i = 0; i < colors; i++)
+            lut[i] = (lut[i] >> 8) | (lut[i] << 8);
+    }
+
+    dma_check(async_wait(self));
+    anim_blit_job_t job;
+    size_t pos;
+    if (blit_job_place(self, &job, w, h, x, y, 1, &pos)) {
+        job.index     = buf_info.buf;
+        job.index_pos = first + pos;
+        job.bpp       = bpp;
+        job.lut       = lut;
+        dma_check(blit_job_send(self, &job));
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(anim_display_blit_indexed_obj, 8, 9, anim_display_blit_indexed);
+
+// ── blit_rects ────────────────────────────────────────────────────────────────
+// blit_rects(buf, stride, rects) -> number of rectangles sent
+// buf is a frame `stride` pixels wide laid out like the screen; rects is a
+// list/tuple of (x, y, w, h) tuples or a flat array('h'/'H') of x, y, w, h.
+// Rectangles are clipped, touching or overlapping ones are merged when their
+// bounding box is no larger than the two areas combined, and each result is
+// sent through the normal blit engine.
+
+typedef struct {
+    int x0, y0, x1, y1;   // exclusive right/bottom
+} anim_rect_t;
+
+static int rect_area(const anim_rect_t *r) {
+    return (r->x1 - r->x0) * (r->y1 - r->y0);
+}
+
+static int rects_merge(anim_rect_t *rects, int n) {
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (int i = 0; i < n; i++) {
+            for (int j = i + 1; j < n; j++) {
+                anim_rect_t *a = &rects[i], *b = &rects[j];
+                if (a->x0 > b->x1 || b->x0 > a->x1 || a->y0 > b->y1 || b->y0 > a->y1)
+                    continue;
+                anim_rect_t u = {
+                    a->x0 < b->x0 ? a->x0 : b->x0, a->y0 < b->y0 ? a->y0 : b->y0,
+                    a->x1 > b->x1 ? a->x1 : b->x1, a->y1 > b->y1 ? a->y1 : b->y1,
+                };
+                if (rect_area(&u) > rect_area(a) + rect_area(b))
+                    continue;
+                *a = u;
+                rects[j] = rects[--n];
+                merged = true;
+                j = i;
             }
         }
+    }
+    return n;
+}
+
+static bool rect_clip(anim_rect_t *r, int x, int y, int w, int h, int max_w, int max_h) {
+    r->x0 = x < 0 ? 0 : x;
+    r->y0 = y < 0 ? 0 : y;
+    r->x1 = x + w > max_w ? max_w : x + w;
+    r->y1 = y + h > max_h ? max_h : y + h;
+    return r->x1 > r->x0 && r->y1 > r->y0;
+}
+
+static mp_obj_t anim_display_blit_rects(size_t n_args, const mp_obj_t *args) {
+    anim_display_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    if (!self->panel_handle || !self->dma_buffers[0])
+        mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("Display not initialized"));
 
-        lcd_panel_active = true;
-        esp_lcd_panel_draw_bitmap(self->panel_handle,
-            dst_x, dst_y + row, dst_x + blit_w, dst_y + row + chunk,
-            self->dma_buffer);
+    mp_buffer_info_t buf_info;
+    mp_get_buffer_raise(args[1], &buf_info, MP_BUFFER_READ);
+    mp_int_t stride = mp_obj_get_int(args[2]);
+    if (stride <= 0)
+        mp_raise_ValueError(MP_ERROR_TEXT("stride must be positive"));
+
+    // The frame covers the screen from (0, 0); never read past either edge
+    int max_w = stride < self->width ? stride : self->width;
+    int max_h = buf_info.len / (stride * sizeof(uint16_t));
+    if (max_h > self->height) max_h = self->height;
+
+    size_t       n = 0, alloc;
+    anim_rect_t *rects;
+    mp_buffer_info_t rect_info;
+    if (mp_get_buffer(args[3], &rect_info, MP_BUFFER_READ)) {
+        if (rect_info.typecode != 'h' && rect_info.typecode != 'H')
+            mp_raise_TypeError(MP_ERROR_TEXT("rects array must be of type 'h' or 'H'"));
+        size_t count = rect_info.len / (4 * sizeof(int16_t));
+        alloc = count ? count : 1;
+        rects = m_new(anim_rect_t, alloc);
+        for (size_t i = 0; i < count; i++) {
+            int v[4];
+            for (int k = 0; k < 4; k++) {
+                v[k] = (rect_info.typecode == 'h')
+                    ? ((const int16_t *)rect_info.buf)[i * 4 + k]
+                    : ((const uint16_t *)rect_info.buf)[i * 4 + k];
+            }
+            if (rect_clip(&rects[n], v[0], v[1], v[2], v[3], max_w, max_h)) n++;
+        }
+    } else {
+        size_t   count;
+        mp_obj_t *items;
+        mp_obj_get_array(args[3], &count, &items);
+        alloc = count ? count : 1;
+        rects = m_new(anim_rect_t, alloc);
+        for (size_t i = 0; i < count; i++) {
+            mp_obj_t *r;
+            mp_obj_get_array_fixed_n(items[i], 4, &r);
+            if (rect_clip(&rects[n], mp_obj_get_int(r[0]), mp_obj_get_int(r[1]),
+                          mp_obj_get_int(r[2]), mp_obj_get_int(r[3]), max_w, max_h)) n++;
+        }
+    }
 
-        for (int i = 0; i < 100 && lcd_panel_active; i++) {}
-        int timeout = 1000;
-        while (lcd_panel_active && timeout-- > 0)
-            vTaskDelay(1 / portTICK_PERIOD_MS);
+    n = rects_merge(rects, n);
+
+    dma_check(async_wait(self));
+    esp_err_t ret = ESP_OK;
+    for (size_t i = 0; i < n && ret == ESP_OK; i++) {
+        anim_blit_job_t job = {
+            .src    = (const uint16_t *)buf_info.buf + rects[i].y0 * stride + rects[i].x0,
+            .stride = stride,
+            .x      = rects[i].x0,
+            .y      = rects[i].y0,
+            .w      = rects[i].x1 - rects[i].x0,
+            .h      = rects[i].y1 - rects[i].y0,
+        };
+        ret = blit_job_send(self, &job);
     }
+    m_del(anim_rect_t, rects, alloc);
+    dma_check(ret);
+    return mp_obj_new_int(n);
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(anim_display_blit_rects_obj, 4, 4, anim_display_blit_rects);
+
+// ── stream_begin / stream_write ───────────────────────────────────────────────
+// stream_begin(x, y, w, h)
+// stream_write(buf)
+// Sends a rectangle in pieces, e.g. rows as they are decoded or rendered,
+// while the address window is set only once. stream_write() takes whole rows
+// of `w` pixels and resumes with RAMWRC (memory write continue), so the stream
+// survives other traffic on the shared SPI bus between calls; the chunks
+// inside one call go out without any command. Setting another window (any
+// blit) ends the stream.
+
+static mp_obj_t anim_display_stream_begin(size_t n_args, const mp_obj_t *args) {
+    anim_display_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    if (!self->panel_handle || !self->dma_buffers[0])
+        mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("Display not initialized"));
+
+    mp_int_t x = mp_obj_get_int(args[1]);
+    mp_int_t y = mp_obj_get_int(args[2]);
+    mp_int_t w = mp_obj_get_int(args[3]);
+    mp_int_t h = mp_obj_get_int(args[4]);
+    if (w <= 0 || h <= 0 || x < 0 || y < 0 || x + w > self->width || y + h > self->height)
+        mp_raise_ValueError(MP_ERROR_TEXT("Stream window out of bounds"));
+
+    dma_check(async_wait(self));
+    dma_reset_pending(self);
+    dma_check(lcd_set_window(self, x, y, w, h));
+    self->stream_w         = w;
+    self->stream_rows_left = h;
+    self->stream_started   = false;
+    shadow_invalidate(self);
     return mp_const_none;
 }
-static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(anim_display_blit_buffer_obj, 6, 6, anim_display_blit_buffer);
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(anim_display_stream_begin_obj, 5, 5, anim_display_stream_begin);
+
+static mp_obj_t anim_display_stream_write(mp_obj_t self_in, mp_obj_t buf_in) {
+    anim_display_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->stream_rows_left == 0)
+        mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("No open stream"));
+    dma_check(async_wait(self));
+
+    mp_buffer_info_t buf_info;
+    mp_get_buffer_raise(buf_in, &buf_info, MP_BUFFER_READ);
+    int rows = buf_info.len / (self->stream_w * sizeof(uint16_t));
+    if (rows == 0 || buf_info.len != rows * self->stream_w * sizeof(uint16_t))
+        mp_raise_ValueError(MP_ERROR_TEXT("Buffer must hold whole rows"));
+    if (rows > self->stream_rows_left)
+        mp_raise_ValueError(MP_ERROR_TEXT("Buffer overruns the stream window"));
+    if (self->color_depth == 12 && (rows * self->stream_w) & 1)
+        mp_raise_ValueError(MP_ERROR_TEXT("12-bit streams need an even pixel count per write"));
+
+    anim_blit_job_t job = {
+        .src    = (const uint16_t *)buf_info.buf,
+        .stride = self->stream_w,
+        .w      = self->stream_w,
+        .h      = rows,
+    };
+    esp_err_t ret = blit_rows(self, &job,
+        self->stream_started ? LCD_CMD_RAMWRC : LCD_CMD_RAMWR);
+    self->stream_started    = true;
+    self->stream_rows_left -= rows;
+    if (ret != ESP_OK)
+        self->stream_rows_left = 0;
+    dma_check(ret);
+    return mp_obj_new_int(self->stream_rows_left);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(anim_display_stream_write_obj, anim_display_stream_write);
+
+// ── wait_vsync ────────────────────────────────────────────────────────────────
+// wait_vsync()
+// Block until the panel enters its next vertical blank (TE rising edge, or
+// the te_hz timer when no TE pin is wired). Async blits are drained first:
+// a vsync=True job waits on the same semaphore and would take the blank.
+
+static mp_obj_t anim_display_wait_vsync(mp_obj_t self_in) {
+    anim_display_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    dma_check(async_wait(self));
+    dma_check(vsync_wait(self));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(anim_display_wait_vsync_obj, anim_display_wait_vsync);
+
+// ── autotune / last_autotune ──────────────────────────────────────────────────
+// autotune(reserve=32768, frames=4) -> dict
+// Re-size the DMA pool and pick dma_rows by measurement; see dma_autotune().
+// Draws black frames while it runs. Returns the chosen dma_rows plus the
+// (dma_rows, frame_us) pairs that were measured.
+// last_autotune() -> dict or None
+// The same report for the most recent run, including the one init() does for
+// dma_rows=-1.
+
+static mp_obj_t autotune_report(anim_display_obj_t *self) {
+    int n = self->autotune_count;
+    mp_obj_t items[ANIM_LCD_AUTOTUNE_STEPS];
+    for (int i = 0; i < n; i++) {
+        mp_obj_t pair[2] = {
+            mp_obj_new_int(self->autotune_results[i].rows),
+            mp_obj_new_int_from_uint(self->autotune_results[i].frame_us),
+        };
+        items[i] = mp_obj_new_tuple(2, pair);
+    }
+    mp_obj_t dict = mp_obj_new_dict(2);
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_dma_rows), mp_obj_new_int(self->dma_rows));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_results), mp_obj_new_list(n, items));
+    return dict;
+}
+
+static mp_obj_t anim_display_autotune(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_reserve, ARG_frames };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_reserve, MP_ARG_INT, {.u_int = ANIM_LCD_AUTOTUNE_RESERVE} },
+        { MP_QSTR_frames,  MP_ARG_INT, {.u_int = 4                        } },
+    };
+    anim_display_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args,
+        MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    if (!self->panel_handle || !self->dma_buffers[0])
+        mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("Display not initialized"));
+    if (args[ARG_reserve].u_int < 0 || args[ARG_frames].u_int < 1)
+        mp_raise_ValueError(MP_ERROR_TEXT("reserve must be >= 0 and frames >= 1"));
+
+    dma_check(async_wait(self));
+    self->stream_rows_left = 0;
+    if (dma_autotune(self, args[ARG_reserve].u_int, args[ARG_frames].u_int) == 0)
+        mp_raise_msg(&mp_type_MemoryError, MP_ERROR_TEXT("Not enough DMA memory to autotune"));
+    return autotune_report(self);
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(anim_display_autotune_obj, 1, anim_display_autotune);
+
+static mp_obj_t anim_display_last_autotune(mp_obj_t self_in) {
+    anim_display_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->autotune_count == 0)
+        return mp_const_none;
+    return autotune_report(self);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(anim_display_last_autotune_obj, anim_display_last_autotune);
+
+#if ANIM_LCD_STATS
+// ── stats / reset_stats ───────────────────────────────────────────────────────
+// stats() -> dict of blit-path counters since the last reset_stats().
+// Comparing copy_cycles, wait_cycles and busy_us tells whether frames are
+// bound by the CPU copy, by the SPI wire, or by waiting on something else.
+// Both drain the async worker first: it updates the counters unlocked, from
+// the other core when feeder=True.
+
+static mp_obj_t anim_display_stats(mp_obj_t self_in) {
+    anim_display_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    dma_check(async_wait(self));
+    const anim_lcd_stats_t *st = &self->stats;
+    mp_obj_t dict = mp_obj_new_dict(8);
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_blits), mp_obj_new_int_from_uint(st->blits));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_chunks), mp_obj_new_int_from_uint(st->chunks));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_bytes), mp_obj_new_int_from_ull(st->bytes));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_copy_cycles), mp_obj_new_int_from_ull(st->copy_cycles));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_wait_cycles), mp_obj_new_int_from_ull(st->wait_cycles));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_max_wait_cycles), mp_obj_new_int_from_uint(st->max_wait_cycles));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_busy_us), mp_obj_new_int_from_ull(st->busy_us));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_bytes_per_s), mp_obj_new_int_from_ull(
+        st->busy_us ? st->bytes * 1000000ULL / st->busy_us : 0));
+    return dict;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(anim_display_stats_obj, anim_display_stats);
+
+static mp_obj_t anim_display_reset_stats(mp_obj_t self_in) {
+    anim_display_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    dma_check(async_wait(self));
+    memset(&self->stats, 0, sizeof(self->stats));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(anim_display_reset_stats_obj, anim_display_reset_stats);
+#endif
+
+// ── wait / busy ───────────────────────────────────────────────────────────────
+
+static mp_obj_t anim_display_wait(mp_obj_t self_in) {
+    anim_display_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    dma_check(async_wait(self));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(anim_display_wait_obj, anim_display_wait);
+
+static mp_obj_t anim_display_busy(mp_obj_t self_in) {
+    anim_display_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(async_running(self) > 0);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(anim_display_busy_obj, anim_display_busy);
+
+// ── diff_mode ─────────────────────────────────────────────────────────────────
+// diff_mode(enabled)
+// Enables or disables the shadow frame diff. Enabling (again) allocates the
+// shadow, preferably in PSRAM, and forces the next full-screen blit to be sent
+// in full.
+
+static mp_obj_t anim_display_diff_mode(mp_obj_t self_in, mp_obj_t val) {
+    anim_display_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    dma_check(async_wait(self));
+    if (!mp_obj_is_true(val)) {
+        shadow_free(self);
+        return mp_const_none;
+    }
+    if (!self->shadow) {
+        size_t size = (size_t)self->width * self->height * sizeof(uint16_t);
+        self->shadow = heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+        if (!self->shadow)
+            self->shadow = heap_caps_malloc(size, MALLOC_CAP_8BIT);
+        if (!self->shadow)
+            mp_raise_msg(&mp_type_MemoryError, MP_ERROR_TEXT("Failed to allocate shadow frame"));
+    }
+    shadow_invalidate(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(anim_display_diff_mode_obj, anim_display_diff_mode);
+
+// ── dma_framebuffer ───────────────────────────────────────────────────────────
+// dma_framebuffer() -> bytearray
+// Returns a width*height RGB565 bytearray backed by DMA-capable internal RAM,
+// so full-width blits from it skip the bounce buffers. The block comes from the
+// framebuffer cache and is never freed; every call returns the same frame.
+
+static mp_obj_t anim_display_dma_framebuffer(mp_obj_t self_in) {
+    anim_display_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (!self->framebuffer) {
+        size_t size = (size_t)self->width * self->height * sizeof(uint16_t);
+        self->framebuffer      = fb_cache_claim(size);
+        self->framebuffer_size = size;
+    }
+    return mp_obj_new_bytearray_by_ref(self->framebuffer_size, self->framebuffer);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(anim_display_dma_framebuffer_obj, anim_display_dma_framebuffer);
 
 // ── png_write ─────────────────────────────────────────────────────────────────
 // tft.png_write(display_buf, filename {, x, y, w, h})
@@ -475,9 +1989,29 @@ static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(anim_display_png_write_obj, 3, 7, ani
 static const mp_rom_map_elem_t anim_display_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_init),           MP_ROM_PTR(&anim_display_init_obj)           },
     { MP_ROM_QSTR(MP_QSTR_deinit),         MP_ROM_PTR(&anim_display_deinit_obj)         },
+    { MP_ROM_QSTR(MP_QSTR___del__),        MP_ROM_PTR(&anim_display_del_obj)            },
     { MP_ROM_QSTR(MP_QSTR_rotation),       MP_ROM_PTR(&anim_display_rotation_obj)       },
     { MP_ROM_QSTR(MP_QSTR_inversion_mode), MP_ROM_PTR(&anim_display_inversion_mode_obj) },
     { MP_ROM_QSTR(MP_QSTR_blit_buffer),    MP_ROM_PTR(&anim_display_blit_buffer_obj)    },
+    { MP_ROM_QSTR(MP_QSTR_blit_buffer_async), MP_ROM_PTR(&anim_display_blit_buffer_async_obj) },
+    { MP_ROM_QSTR(MP_QSTR_blit_scaled),    MP_ROM_PTR(&anim_display_blit_scaled_obj)    },
+    { MP_ROM_QSTR(MP_QSTR_blit_indexed),   MP_ROM_PTR(&anim_display_blit_indexed_obj)   },
+    { MP_ROM_QSTR(MP_QSTR_blit_rects),     MP_ROM_PTR(&anim_display_blit_rects_obj)     },
+    { MP_ROM_QSTR(MP_QSTR_stream_begin),   MP_ROM_PTR(&anim_display_stream_begin_obj)   },
+    { MP_ROM_QSTR(MP_QSTR_stream_write),   MP_ROM_PTR(&anim_display_stream_write_obj)   },
+    { MP_ROM_QSTR(MP_QSTR_wait),           MP_ROM_PTR(&anim_display_wait_obj)           },
+    { MP_ROM_QSTR(MP_QSTR_wait_vsync),     MP_ROM_PTR(&anim_display_wait_vsync_obj)     },
+    { MP_ROM_QSTR(MP_QSTR_busy),           MP_ROM_PTR(&anim_display_busy_obj)           },
+    { MP_ROM_QSTR(MP_QSTR_autotune),       MP_ROM_PTR(&anim_display_autotune_obj)       },
+    { MP_ROM_QSTR(MP_QSTR_last_autotune),  MP_ROM_PTR(&anim_display_last_autotune_obj)  },
+#if ANIM_LCD_STATS
+    { MP_ROM_QSTR(MP_QSTR_stats),          MP_ROM_PTR(&anim_display_stats_obj)          },
+    { MP_ROM_QSTR(MP_QSTR_reset_stats),    MP_ROM_PTR(&anim_display_reset_stats_obj)    },
+#endif
+    { MP_ROM_QSTR(MP_QSTR_dma_framebuffer), MP_ROM_PTR(&anim_display_dma_framebuffer_obj) },
+    { MP_ROM_QSTR(MP_QSTR_diff_mode),      MP_ROM_PTR(&anim_display_diff_mode_obj)      },
+    { MP_ROM_QSTR(MP_QSTR_vscroll_define), MP_ROM_PTR(&anim_display_vscroll_define_obj) },
+    { MP_ROM_QSTR(MP_QSTR_vscroll),        MP_ROM_PTR(&anim_display_vscroll_obj)        },
     { MP_ROM_QSTR(MP_QSTR_png_write),      MP_ROM_PTR(&anim_display_png_write_obj)      },
 };
 static MP_DEFINE_CONST_DICT(anim_display_locals_dict, anim_display_locals_dict_table);
@@ -28,13 +28,31 @@
 #include "py/obj.h"
 #include "esp_lcd_panel_io.h"
 #include "driver/spi_master.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "esp_timer.h"
 #include "esp_spi.h"
 #include <stdbool.h>
 
-extern volatile bool lcd_panel_active;
-bool lcd_panel_done(esp_lcd_panel_io_handle_t panel_io,
-                    esp_lcd_panel_io_event_data_t *edata,
-                    void *user_ctx);
+#define ANIM_LCD_MAX_DMA_BUFFERS  8
+#define ANIM_LCD_DMA_TIMEOUT_MS   1000
+#define ANIM_LCD_ASYNC_STACK      3072
+#define ANIM_LCD_MAX_ASYNC_QUEUE  8       // feeder_queue upper limit
+#define ST7789_FRAME_LINES        320     // frame memory rows, the hardware scroll axis
+#define ST7789_COLMOD_RGB444      0x53    // 12 bits per pixel over the MCU interface
+#define ANIM_LCD_MAX_SCALE        8       // blit_scaled() upper limit
+#define ANIM_LCD_VSYNC_TIMEOUT_MS 100     // several refresh periods at any TE rate
+#define ANIM_LCD_AUTOTUNE_RESERVE 32768   // DMA heap autotune leaves free by default
+#define ANIM_LCD_AUTOTUNE_STEPS   8       // dma_rows candidates tried per sweep
+#define ANIM_LCD_MAX_FRAMEBUFFERS 4       // dma_framebuffer() blocks kept for reuse
+
+// Blit-path counters for tft.stats(); build with -DANIM_LCD_STATS=0 to compile
+// them out of the hot path entirely.
+#ifndef ANIM_LCD_STATS
+#define ANIM_LCD_STATS            1
+#endif
 
 // ── SPI Bus object ────────────────────────────────────────────────────────────
 
@@ -49,6 +67,7 @@ typedef struct _esp_lcd_spi_bus_obj_t {
     unsigned int pclk_hz;
     int lcd_cmd_bits;
     int lcd_param_bits;
+    int trans_queue_depth;
     esp_lcd_panel_io_handle_t io_handle;
     spi_device_handle_t spi_dev;
 
@@ -67,6 +86,43 @@ extern const mp_obj_type_t esp_lcd_spi_bus_type;
 
 // ── Display object ────────────────────────────────────────────────────────────
 
+#if ANIM_LCD_STATS
+// Cycle counts come from the CPU cycle counter of the core running the blit.
+typedef struct {
+    uint32_t blits;            // rectangles sent through the engine
+    uint32_t chunks;           // colour transfers queued
+    uint64_t bytes;            // colour bytes queued
+    uint64_t copy_cycles;      // copying/byte-swapping into DMA buffers
+    uint64_t wait_cycles;      // blocked on DMA completion
+    uint32_t max_wait_cycles;  // longest single wait
+    uint64_t busy_us;          // wall time spent inside the engine
+} anim_lcd_stats_t;
+#endif
+
+// One dma_rows candidate measured by autotune
+typedef struct {
+    uint16_t rows;
+    uint32_t frame_us;
+} anim_autotune_result_t;
+
+// One clipped rectangle for the blit engine: `src` points at the first source
+// pixel and `stride` is the source row length in pixels. A scaled job draws
+// every source pixel as a scale×scale block; phase_x/phase_y say how far into
+// the first block the clipped rectangle starts. An indexed job reads `bpp`-bit
+// palette indices from `index`, starting at pixel `index_pos`, through `lut`.
+typedef struct {
+    const uint16_t *src;
+    int             stride;
+    int             x, y, w, h;
+    bool            vsync;   // wait for the next vertical blank before sending
+    uint8_t         scale;   // 0 or 1 = unscaled
+    uint8_t         phase_x, phase_y;
+    const uint8_t  *index;
+    const uint16_t *lut;     // NULL = RGB565 source; entries in wire byte order
+    size_t          index_pos;
+    uint8_t         bpp;
+} anim_blit_job_t;
+
 typedef struct _anim_display_obj_t {
     mp_obj_base_t              base;
     mp_obj_t                   bus;
@@ -75,15 +131,69 @@ typedef struct _anim_display_obj_t {
     uint16_t                   width;
     uint16_t                   height;
     uint8_t                    rotation;
+    uint16_t                   x_gap, y_gap;  // from the active rotation table entry
+    bool                       swap_xy;
+    bool                       mirror_y;
     bool                       inversion_mode;
     bool                       swap_color_bytes;
     gpio_num_t                 rst;
     uint8_t                    color_space;
+    uint8_t                    color_depth;    // bits per pixel on the wire: 16 or 12
     uint16_t                   dma_rows;
-    uint16_t                  *dma_buffer;
+    bool                       dma_rows_auto;  // dma_rows=-1: autotune on init()
+    anim_autotune_result_t     autotune_results[ANIM_LCD_AUTOTUNE_STEPS]; // last run
+    uint8_t                    autotune_count;   // 0 = never run or nothing fit
+    uint8_t                    dma_buffer_count;
+    uint8_t                    queue_depth;   // colour transfers queued at once
+    uint16_t                  *dma_buffers[ANIM_LCD_MAX_DMA_BUFFERS];
     size_t                     dma_buffer_size;
+    uint16_t                  *row_buf;       // one expanded row, for RGB444 packing
+    SemaphoreHandle_t          dma_done;      // given once per finished colour transfer
+    int                        dma_pending;   // colour transfers queued, not yet taken
+    uint16_t                  *framebuffer;   // DMA-capable frame from dma_framebuffer()
+    size_t                     framebuffer_size;
+    uint16_t                  *shadow;        // last frame sent, NULL unless diff_mode
+    bool                       shadow_valid;
+    uint16_t                   scroll_tfa;    // frame-memory row of the first scrolling line
+    uint16_t                   scroll_height; // 0 = no scroll area defined
+    int                        scroll_offset;
+    uint16_t                   stream_w;         // stream_begin() window width
+    uint16_t                   stream_rows_left; // 0 = no open stream
+    bool                       stream_started;   // RAMWR sent, resume with RAMWRC
+    uint8_t                    band_slot;        // next DMA buffer for band output
+    bool                       band_first;       // next band starts the frame
+
+    // Vertical blank pacing: the panel TE pin, or a timer at te_hz without one
+    gpio_num_t                 te;
+    uint16_t                   te_hz;
+    SemaphoreHandle_t          vsync;
+    esp_timer_handle_t         vsync_timer;
+
+#if ANIM_LCD_STATS
+    anim_lcd_stats_t           stats;
+#endif
+
+    // blit_buffer_async() worker, optionally pinned to the other core
+    TaskHandle_t               async_task;
+    QueueHandle_t              async_queue;   // jobs waiting for the worker
+    SemaphoreHandle_t          async_done;    // given once per finished job
+    mp_obj_t                   async_bufs[ANIM_LCD_MAX_ASYNC_QUEUE]; // pin sources, FIFO
+    uint8_t                    async_head;    // oldest unfinished job in async_bufs
+    uint8_t                    async_count;   // jobs submitted, not yet reclaimed
+    uint8_t                    async_depth;   // queue length: 1, or feeder_queue
+    bool                       feeder;        // worker pinned to the other core
+    volatile esp_err_t         async_err;     // first failure since the last wait()
 } anim_display_obj_t;
 
 extern const mp_obj_type_t anim_display_type;
 
+// Band output for compositors that render straight into the DMA buffers
+// (animation.render). A frame is begin, then per band: buffer, fill it in
+// framebuffer byte order, send; then end. While a band is composed the
+// previous ones are still going out over SPI. These raise on error.
+int       anim_display_band_begin(anim_display_obj_t *self);   // -> rows per band
+uint16_t *anim_display_band_buffer(anim_display_obj_t *self);
+void      anim_display_band_send(anim_display_obj_t *self, uint16_t *band, int rows);
+void      anim_display_band_end(anim_display_obj_t *self);
+
 #endif /* __ESP_LCD_H__ */
@@ -0,0 +1,101 @@
+'''
+    On-device check for firmware built with -DANIMATION_BENCH=1.
+
+    Runs every clip and crop mode, alone and combined, at the screen edges
+    and with and without opacity, plus "between" crops with inverted ranges,
+    through animation.bench_draw_all, and checks animation.bench_blend
+    against the 8-bit reference. Raises AssertionError if either compositor
+    disagrees with its reference.
+
+    Usage:
+        mpremote run utils/bench_check.py
+'''
+
+import animation
+
+WIDTH = 240
+HEIGHT = 240
+SPRITE = 24
+MAGIC = 58572   # animation's transparency key
+
+CLIP_MODES = (None, "after", "before")
+CROP_MODES = (None, "between", "outside")
+
+# Inside the screen, past the top-left corner and past the bottom-right one.
+# Chosen so that no cutoff below lands on 0, which disables the axis.
+POSITIONS = ((100, 100), (-10, -9), (228, 226))
+
+
+def make_sprite():
+    '''A gradient sprite with a band of transparent pixels through it.'''
+
+    buf = bytearray(SPRITE * SPRITE * 2)
+    for y in range(SPRITE):
+        for x in range(SPRITE):
+            color = MAGIC if 8 <= x < 12 else (x << 11) | (y << 5) | (x ^ y)
+            i = (y * SPRITE + x) * 2
+            buf[i] = color >> 8
+            buf[i + 1] = color & 0xFF
+    return buf
+
+
+def set_scene(sprite, clip_x, clip_y, crop_x, crop_y, opacity, inverted=False):
+    lo, hi = (17, 6) if inverted else (6, 17)
+    animation.clear_slots()
+    for i, (x, y) in enumerate(POSITIONS):
+        animation.set_slot(i, sprite, x, y, SPRITE, SPRITE)
+        animation.set_slot_clip(
+            i,
+            x + 12 if clip_x else 0, clip_x or "after",
+            y + 12 if clip_y else 0, clip_y or "after")
+        animation.set_slot_crop(
+            i,
+            x + lo if crop_x else 0, x + hi if crop_x else 0, crop_x or "between",
+            y + lo if crop_y else 0, y + hi if crop_y else 0, crop_y or "between")
+        animation.set_slot_opacity(i, opacity)
+
+
+def check_draw_all(sprite, display_buf, scratch):
+    failures = []
+    for opacity in (255, 128):
+        for clip_x in CLIP_MODES:
+            for clip_y in CLIP_MODES:
+                for crop_x in CROP_MODES:
+                    for crop_y in CROP_MODES:
+                        set_scene(sprite, clip_x, clip_y, crop_x, crop_y, opacity)
+                        if not animation.bench_draw_all(display_buf, scratch, 1)[2]:
+                            failures.append((clip_x, clip_y, crop_x, crop_y, opacity))
+        # crop_x0 > crop_x1 hides nothing in "between" mode
+        for crop_x, crop_y in (("between", None), (None, "between"), ("between", "between")):
+            set_scene(sprite, None, None, crop_x, crop_y, opacity, inverted=True)
+            if not animation.bench_draw_all(display_buf, scratch, 1)[2]:
+                failures.append((None, None, f'{crop_x} inverted', f'{crop_y} inverted', opacity))
+    return failures
+
+
+def main():
+    animation.set_display_size(WIDTH, HEIGHT)
+    size = WIDTH * HEIGHT * 2
+    display_buf = bytearray(bytes(range(256)) * (size // 256 + 1))[:size]
+    scratch = bytearray(size)
+    sprite = make_sprite()
+
+    failures = check_draw_all(sprite, display_buf, scratch)
+    for clip_x, clip_y, crop_x, crop_y, opacity in failures:
+        print(f'draw_all mismatch: clip {clip_x}/{clip_y} crop {crop_x}/{crop_y} opacity {opacity}')
+
+    set_scene(sprite, "after", "before", "between", "outside", 128)
+    ref_us, new_us, match = animation.bench_draw_all(display_buf, scratch, 100)
+    print(f'draw_all: ref {ref_us} us, new {new_us} us, match {match}')
+    if not match:
+        failures.append('timed scene')
+
+    ref_us, swar_us, max_err = animation.bench_blend(WIDTH)
+    print(f'blend: ref {ref_us} us, swar {swar_us} us, max_err {max_err}')
+
+    assert not failures, f'{len(failures)} draw_all scene(s) differ from the reference'
+    assert max_err <= 1, f'blend max_err {max_err} > 1'
+    print('OK')
+
+
+main()
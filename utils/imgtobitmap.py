@@ -3,11 +3,17 @@
     Convert image file to python module for use with blit_bitmap.
 
     Usage imgtobitmap image_file bits_per_pixel >image.py
+
+    With --alpha, emits RGB565 pixels (BITMAP) and an 8-bit alpha plane (ALPHA)
+    from an image with transparency, for animation.set_slot_alpha:
+
+    Usage imgtobitmap --alpha image_file >image.py
 '''
 
 import sys
 from PIL import Image
 import argparse
+from rgb565a8 import print_bytes, rgb565a8
 
 
 def main():
@@ -23,15 +29,32 @@ def main():
     parser.add_argument(
         'bits_per_pixel',
         type=int,
+        nargs='?',
         choices=range(1, 9),
         default=1,
         metavar='bits_per_pixel',
         help='The number of bits to use per pixel (1..8)')
 
+    parser.add_argument(
+        '-a', '--alpha',
+        action='store_true',
+        help='Emit RGB565 pixels plus an 8-bit alpha plane for the animation module '
+             'instead of an indexed bitmap; bits_per_pixel is ignored')
+
     args = parser.parse_args()
     bits = args.bits_per_pixel
     colors_requested = 1 << bits
     img = Image.open(args.image_file)
+
+    if args.alpha:
+        img = img.convert("RGBA")
+        pixels, alpha = rgb565a8(img, [(0, 0, img.width, img.height)])
+        print(f'HEIGHT = {img.height}')
+        print(f'WIDTH = {img.width}')
+        print_bytes('BITMAP', pixels)
+        print_bytes('ALPHA', alpha)
+        return
+
     img = img.convert("P", palette=Image.Palette.ADAPTIVE, colors=colors_requested)
     palette = img.getpalette()  # Make copy of palette colors
     palette_colors = len(palette) // 3
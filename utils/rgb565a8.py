@@ -0,0 +1,34 @@
+'''
+    RGB565 + A8 helpers shared by imgtobitmap and sprites2bitmap for the
+    --alpha output used by animation.set_slot and animation.set_slot_alpha.
+'''
+
+
+def print_bytes(name, data):
+    '''Print `data` as python source for a memoryview named `name`.'''
+
+    print(f"_{name.lower()} =\\", sep='')
+    print("b'", sep='', end='')
+    for i, value in enumerate(data):
+        if i and i % 16 == 0:
+            print("'\\\nb'", end='', sep='')
+        print(f'\\x{value:02x}', sep='', end='')
+    print(f"'\n{name} = memoryview(_{name.lower()})")
+
+
+def rgb565a8(img, boxes):
+    '''
+        Big-endian RGB565 pixels and an A8 alpha plane for each box of an RGBA
+        image, as used by animation.set_slot and animation.set_slot_alpha.
+    '''
+
+    pixels = bytearray()
+    alpha = bytearray()
+    for x0, y0, x1, y1 in boxes:
+        for y in range(y0, y1):
+            for x in range(x0, x1):
+                r, g, b, a = img.getpixel((x, y))
+                color565 = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | ((b & 0xF8) >> 3)
+                pixels += bytes((color565 >> 8, color565 & 0xff))
+                alpha.append(a)
+    return pixels, alpha
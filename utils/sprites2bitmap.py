@@ -11,13 +11,24 @@
     MicroPython:
         import sprites
         ... tft config and init code ...
-        tft.bitmap(sprites, x, y, index)
+        tft.blit_indexed(sprites.BITMAP, sprites.PALETTE, x, y,
+                         sprites.WIDTH, sprites.HEIGHT, sprites.BPP, index)
+
+    With --alpha, each sprite is emitted as RGB565 pixels (BITMAP) plus an 8-bit
+    alpha plane (ALPHA), one after another, for the animation module:
+
+        sprites2bitmap --alpha image_file sprite_width sprite_height >sprites.py
+
+        animation.set_slot(1, sprites.BITMAP, x, y, sprites.WIDTH, sprites.HEIGHT)
+        animation.set_slot_alpha(1, sprites.ALPHA)
+        animation.update_slot_frame(1, index)
 
 '''
 
 from os import setpriority
 from PIL import Image
 import argparse
+from rgb565a8 import print_bytes, rgb565a8
 
 def main():
 
@@ -42,15 +53,42 @@ def main():
     parser.add_argument(
         'bits_per_pixel',
         type=int,
+        nargs='?',
         choices=range(1, 9),
         default=1,
         metavar='bits_per_pixel',
         help='The number of bits to use per pixel (1..8)')
 
+    parser.add_argument(
+        '-a', '--alpha',
+        action='store_true',
+        help='Emit RGB565 pixels plus an 8-bit alpha plane for the animation module '
+             'instead of an indexed bitmap; bits_per_pixel is ignored')
+
     args = parser.parse_args()
 
     bits = args.bits_per_pixel
     img = Image.open(args.image_file)
+
+    if img.width % args.sprite_width or img.height % args.sprite_height:
+        parser.error(
+            f'{img.width}x{img.height} sheet is not a multiple of the '
+            f'{args.sprite_width}x{args.sprite_height} sprite size')
+
+    if args.alpha:
+        img = img.convert("RGBA")
+        boxes = [
+            (x, y, x + args.sprite_width, y + args.sprite_height)
+            for y in range(0, img.height, args.sprite_height)
+            for x in range(0, img.width, args.sprite_width)]
+        pixels, alpha = rgb565a8(img, boxes)
+        print(f'BITMAPS = {len(boxes)}')
+        print(f'HEIGHT = {args.sprite_height}')
+        print(f'WIDTH = {args.sprite_width}')
+        print_bytes('BITMAP', pixels)
+        print_bytes('ALPHA', alpha)
+        return
+
     img = img.convert("P", palette=Image.ADAPTIVE, colors=2**bits)
     palette = img.getpalette()  # Make copy of palette colors
 